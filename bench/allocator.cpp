@@ -0,0 +1,507 @@
+/*
+============================================================
+                        BENCH INFO
+
+BENCH NAME:         allocator.cpp
+BENCH WRITTEN BY:   Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        BENCH PURPOSE
+
+This benchmark measures the latency of every single
+allocation, reallocation, and free made by muma's
+allocators, compared against `malloc`, to show their
+worst-case behavior (not just their average).
+
+There are four workloads:
+
+"random": random allocations, reallocations, and frees of
+sizes between 16 bytes and 64 KiB, with up to 4096 blocks
+alive at once.
+
+"dynamic_array": pushing elements one by one onto 64
+dynamic arrays of `uint64_m` (using the implementation as
+muma's allocator), with each array being destroyed once it
+reaches a random length of up to 4096 elements, measuring
+every push and destruction.
+
+"threads": the same as "dynamic_array", but split across
+1, 2, 4, ... threads (each with its own arrays), only
+measuring total throughput. This is only ran for the
+thread-safe implementations ("malloc" and "muma_caching").
+
+"large_free": allocating, touching, and freeing buffers of
+1 to 64 MiB through `muma_malloc` and `muma_free`, measuring
+every free, either right away ("malloc") or deferred to a
+background thread ("muma_deferred_free"). The time taken by
+the final `muma_deferred_free_flush` is reported too.
+
+Each case prints one JSON object per line with the
+throughput, the 50th, 99th, and 99.9th percentile and
+maximum latency of a single operation (in ns, including
+around 20-50ns of timer overhead), and peak RSS (in KiB).
+The buddy allocator's cases also report its fragmentation
+and how many reallocations were done in place, taken right
+before the blocks still alive at the end are freed.
+
+Build and run it from the `bench` folder like so:
+
+g++ -O2 -std=c++11 -pthread -I.. allocator.cpp -o allocator
+./allocator > ../bench_output.txt
+
+Options (all optional):
+
+--ops N          amount of operations per case (default 10^6)
+--seed N         seed of the random operations (default 1)
+--region-mib N   size of the region given to region-based
+                 allocators, in MiB (default 256)
+--threads N      most threads for the "threads" workload
+                 (default 64)
+--large-ops N    amount of frees in the "large_free"
+                 workload (default 256)
+--impl NAME      only run "malloc", "muma_tlsf",
+                 "muma_buddy", "muma_caching", or
+                 "muma_deferred_free"
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain,
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+// Include shared bench helpers (must come before muma)
+#include "bench.h"
+
+// Include muma
+#define MUMA_IMPLEMENTATION
+#include "muMemoryAllocator.h"
+
+#include <algorithm>
+#include <vector>
+
+/* Declarations */
+
+	static muBool u64_equal(uint64_m a, uint64_m b) { return a == b; }
+	mu_dynamic_array_declaration(u64_array, uint64_m, u64_array_, u64_equal)
+
+/* Implementations */
+
+	// Every implementation is used through a mumaAllocator, so the
+	// workloads are the same for all of them
+
+	static void* malloc_allocate(void*, size_m size) { return malloc(size); }
+	static void* malloc_reallocate(void*, void* p, size_m, size_m new_size) { return realloc(p, new_size); }
+	static void malloc_deallocate(void*, void* p, size_m) { free(p); }
+
+	static bool make_allocator(const char* impl, void* region, size_t region_size, mumaAllocator* a) {
+		if (strcmp(impl, "malloc") == 0) {
+			a->allocate = malloc_allocate;
+			a->reallocate = malloc_reallocate;
+			a->deallocate = malloc_deallocate;
+			a->user_data = 0;
+			a->budget = 0;
+			return true;
+		}
+		if (strcmp(impl, "muma_tlsf") == 0) {
+			mumaTLSF* tlsf = muma_tlsf_create(region, region_size);
+			if (!tlsf) {
+				return false;
+			}
+			*a = muma_tlsf_allocator(tlsf);
+			return true;
+		}
+		if (strcmp(impl, "muma_buddy") == 0) {
+			mumaBuddy* buddy = muma_buddy_create(region, region_size, 0);
+			if (!buddy) {
+				return false;
+			}
+			*a = muma_buddy_allocator(buddy);
+			return true;
+		}
+		if (strcmp(impl, "muma_caching") == 0) {
+			mumaCachingAllocator* caching = muma_caching_create(0);
+			if (!caching) {
+				return false;
+			}
+			*a = muma_caching_allocator(caching);
+			return true;
+		}
+		return false;
+	}
+
+	static void free_allocator(const char* impl, mumaAllocator a) {
+		if (strcmp(impl, "muma_caching") == 0) {
+			muma_caching_destroy((mumaCachingAllocator*)a.user_data);
+		}
+	}
+
+	// Statistics of the buddy allocator, if it is the one being run,
+	// taken before the workload's cleanup
+
+	static mumaBuddy* current_buddy = 0;
+	static mumaBuddyStats buddy_stats;
+
+	static void take_stats(void) {
+		if (current_buddy) {
+			buddy_stats = muma_buddy_get_stats(current_buddy);
+		}
+	}
+
+/* Cases */
+
+	// xorshift64*, so every implementation makes the same operations
+	static uint64_m next_random(uint64_m* x) {
+		*x ^= *x >> 12;
+		*x ^= *x << 25;
+		*x ^= *x >> 27;
+		return *x * 2685821657736338717ULL;
+	}
+
+	// Mostly small sizes, sometimes large ones
+	static size_t random_size(uint64_m* x) {
+		uint64_m r = next_random(x);
+		size_t max = ((r & 7) == 0) ? 65536 : 512;
+		return 16 + (size_t)((r >> 8) % max);
+	}
+
+	#define RANDOM_SLOTS 4096
+
+	static void run_random(mumaAllocator a, size_t ops, uint64_m seed, std::vector<float>& latencies) {
+		std::vector<void*> blocks(RANDOM_SLOTS, (void*)0);
+		std::vector<size_t> sizes(RANDOM_SLOTS, 0);
+		uint64_m x = seed*2654435761ULL + 1;
+
+		for (size_t i = 0; i < ops; i++) {
+			uint64_m r = next_random(&x);
+			size_t slot = (size_t)(r % RANDOM_SLOTS);
+			size_t size = random_size(&x);
+			double begin, end;
+
+			if (blocks[slot] == 0) {
+				begin = bench_now_ns();
+				blocks[slot] = a.allocate(a.user_data, size);
+				end = bench_now_ns();
+				sizes[slot] = size;
+			} else if ((r >> 32) & 1) {
+				begin = bench_now_ns();
+				void* p = a.reallocate(a.user_data, blocks[slot], sizes[slot], size);
+				end = bench_now_ns();
+				if (p) {
+					blocks[slot] = p;
+					sizes[slot] = size;
+				}
+			} else {
+				begin = bench_now_ns();
+				a.deallocate(a.user_data, blocks[slot], sizes[slot]);
+				end = bench_now_ns();
+				blocks[slot] = 0;
+			}
+
+			// Touch the memory like a real user would
+			if (blocks[slot]) {
+				*(volatile char*)blocks[slot] = 1;
+			}
+			latencies.push_back((float)(end - begin));
+		}
+
+		take_stats();
+		for (size_t i = 0; i < RANDOM_SLOTS; i++) {
+			if (blocks[i]) {
+				a.deallocate(a.user_data, blocks[i], sizes[i]);
+			}
+		}
+	}
+
+	#define DYNAMIC_ARRAYS 64
+
+	static void run_dynamic_array(mumaAllocator a, size_t ops, uint64_m seed, std::vector<float>& latencies) {
+		mumaAllocator previous = muma_set_allocator(&a);
+		u64_array arrays[DYNAMIC_ARRAYS];
+		for (size_t i = 0; i < DYNAMIC_ARRAYS; i++) {
+			arrays[i] = u64_array_create(0, 0);
+		}
+		uint64_m x = seed*2654435761ULL + 1;
+
+		for (size_t i = 0; i < ops; i++) {
+			uint64_m r = next_random(&x);
+			size_t arr = (size_t)(r % DYNAMIC_ARRAYS);
+			double begin, end;
+
+			if (arrays[arr].length >= 1 + (size_t)((r >> 32) % 4096)) {
+				begin = bench_now_ns();
+				arrays[arr] = u64_array_destroy(0, arrays[arr]);
+				end = bench_now_ns();
+			} else {
+				begin = bench_now_ns();
+				arrays[arr] = u64_array_push(0, arrays[arr], (uint64_m)i);
+				end = bench_now_ns();
+			}
+			latencies.push_back((float)(end - begin));
+		}
+
+		take_stats();
+		for (size_t i = 0; i < DYNAMIC_ARRAYS; i++) {
+			arrays[i] = u64_array_destroy(0, arrays[i]);
+		}
+		muma_set_allocator(&previous);
+	}
+
+	static double percentile(const std::vector<float>& sorted, double p) {
+		size_t i = (size_t)(p * (double)(sorted.size() - 1));
+		return (double)sorted[i];
+	}
+
+	static void report_case(const char* impl, const char* workload, size_t ops, uint64_m seed, void* region, size_t region_size) {
+		mumaAllocator a;
+		if (!make_allocator(impl, region, region_size, &a)) {
+			return;
+		}
+		current_buddy = (strcmp(impl, "muma_buddy") == 0) ? (mumaBuddy*)a.user_data : 0;
+
+		std::vector<float> latencies;
+		latencies.reserve(ops);
+
+		bench_reset_peak_rss();
+		double begin = bench_now_ns();
+		if (strcmp(workload, "random") == 0) {
+			run_random(a, ops, seed, latencies);
+		} else {
+			run_dynamic_array(a, ops, seed, latencies);
+		}
+		double end = bench_now_ns();
+
+		std::sort(latencies.begin(), latencies.end());
+		bench_record record("allocator");
+		record.str("impl", impl)
+			.str("workload", workload)
+			.integer("ops", ops)
+			.num("mops_per_s", (double)ops / ((end - begin) / 1e3))
+			.num("p50_ns", percentile(latencies, 0.5))
+			.num("p99_ns", percentile(latencies, 0.99))
+			.num("p999_ns", percentile(latencies, 0.999))
+			.num("max_ns", (double)latencies.back())
+			.integer("peak_rss_kib", bench_peak_rss_kib());
+		if (current_buddy) {
+			record.num("internal_fragmentation", buddy_stats.internal_fragmentation)
+				.num("external_fragmentation", buddy_stats.external_fragmentation)
+				.integer("free_blocks", buddy_stats.free_blocks)
+				.integer("in_place_reallocs", buddy_stats.in_place_reallocs)
+				.integer("moved_reallocs", buddy_stats.moved_reallocs);
+		}
+		record.print();
+		free_allocator(impl, a);
+	}
+
+	struct thread_case {
+		const char* impl;
+		mumaAllocator allocator;
+		size_t ops;
+		uint64_m seed;
+	};
+
+	#define THREAD_ARRAYS 16
+
+	static void thread_task(void* user_data, size_m index) {
+		thread_case* tc = (thread_case*)user_data;
+		mumaAllocator previous = muma_set_allocator(&tc->allocator);
+		u64_array arrays[THREAD_ARRAYS];
+		for (size_t i = 0; i < THREAD_ARRAYS; i++) {
+			arrays[i] = u64_array_create(0, 0);
+		}
+		uint64_m x = (tc->seed + index)*2654435761ULL + 1;
+
+		for (size_t i = 0; i < tc->ops; i++) {
+			uint64_m r = next_random(&x);
+			size_t arr = (size_t)(r % THREAD_ARRAYS);
+			if (arrays[arr].length >= 1 + (size_t)((r >> 32) % 4096)) {
+				arrays[arr] = u64_array_destroy(0, arrays[arr]);
+			} else {
+				arrays[arr] = u64_array_push(0, arrays[arr], (uint64_m)i);
+			}
+		}
+
+		for (size_t i = 0; i < THREAD_ARRAYS; i++) {
+			arrays[i] = u64_array_destroy(0, arrays[i]);
+		}
+		if (strcmp(tc->impl, "muma_caching") == 0) {
+			muma_caching_flush((mumaCachingAllocator*)tc->allocator.user_data);
+		}
+		muma_set_allocator(&previous);
+	}
+
+	static void report_threads_case(const char* impl, size_t ops, uint64_m seed, size_t threads) {
+		thread_case tc;
+		if (!make_allocator(impl, 0, 0, &tc.allocator)) {
+			return;
+		}
+		tc.impl = impl;
+		tc.ops = ops / threads;
+		tc.seed = seed;
+
+		double begin = bench_now_ns();
+		muma_parallel_run(threads, thread_task, &tc);
+		double end = bench_now_ns();
+
+		bench_record("allocator")
+			.str("impl", impl)
+			.str("workload", "threads")
+			.integer("ops", tc.ops * threads)
+			.integer("threads", threads)
+			.num("mops_per_s", (double)(tc.ops * threads) / ((end - begin) / 1e3))
+			.integer("peak_rss_kib", bench_peak_rss_kib())
+			.print();
+		free_allocator(impl, tc.allocator);
+	}
+
+	static void report_large_free_case(const char* impl, size_t ops, uint64_m seed) {
+		const bool deferred = strcmp(impl, "muma_deferred_free") == 0;
+		if (deferred) {
+			mumaResult result;
+			muma_deferred_free_start(&result, 1 << 20);
+			if (result != MUMA_SUCCESS) {
+				return;
+			}
+		}
+
+		std::vector<float> latencies;
+		latencies.reserve(ops);
+		uint64_m x = seed*2654435761ULL + 1;
+
+		bench_reset_peak_rss();
+		double begin = bench_now_ns();
+		for (size_t i = 0; i < ops; i++) {
+			size_t size = (size_t)(1 + next_random(&x) % 64) << 20;
+			void* p = muma_malloc(0, size);
+			if (!p) {
+				break;
+			}
+			memset(p, (int)i, size);
+
+			double t = bench_now_ns();
+			muma_free(p, size);
+			latencies.push_back((float)(bench_now_ns() - t));
+		}
+		double flush_begin = bench_now_ns();
+		muma_deferred_free_flush();
+		double end = bench_now_ns();
+		mumaDeferredFreeStats stats = muma_deferred_free_get_stats();
+		if (deferred) {
+			muma_deferred_free_stop();
+		}
+		if (latencies.empty()) {
+			return;
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+		bench_record("allocator")
+			.str("impl", impl)
+			.str("workload", "large_free")
+			.integer("ops", latencies.size())
+			.num("mops_per_s", (double)latencies.size() / ((end - begin) / 1e3))
+			.num("p50_ns", percentile(latencies, 0.5))
+			.num("p99_ns", percentile(latencies, 0.99))
+			.num("p999_ns", percentile(latencies, 0.999))
+			.num("max_ns", (double)latencies.back())
+			.num("flush_ms", (end - flush_begin) / 1e6)
+			.integer("deferred_count", stats.deferred_count)
+			.integer("peak_rss_kib", bench_peak_rss_kib())
+			.print();
+	}
+
+int main(int argc, char** argv) {
+	size_t ops = (size_t)bench_arg(argc, argv, "--ops", 1000000ULL);
+	uint64_m seed = (uint64_m)bench_arg(argc, argv, "--seed", 1);
+	size_t region_size = (size_t)bench_arg(argc, argv, "--region-mib", 256) << 20;
+	const char* only_impl = bench_arg_str(argc, argv, "--impl", 0);
+
+	// The region is touched up front so that page faults aren't
+	// counted as allocator latency
+	void* region = malloc(region_size);
+	if (!region) {
+		return 1;
+	}
+	memset(region, 0, region_size);
+
+	size_t max_threads = (size_t)bench_arg(argc, argv, "--threads", 64);
+	size_t large_ops = (size_t)bench_arg(argc, argv, "--large-ops", 256);
+
+	static const char* impls[] = { "malloc", "muma_tlsf", "muma_buddy", "muma_caching" };
+	static const char* thread_impls[] = { "malloc", "muma_caching" };
+	static const char* large_free_impls[] = { "malloc", "muma_deferred_free" };
+	static const char* workloads[] = { "random", "dynamic_array" };
+
+	for (size_t w = 0; w < sizeof(workloads)/sizeof(workloads[0]); w++) {
+		for (size_t i = 0; i < sizeof(impls)/sizeof(impls[0]); i++) {
+			if (!only_impl || strcmp(only_impl, impls[i]) == 0) {
+				report_case(impls[i], workloads[w], ops, seed, region, region_size);
+			}
+		}
+	}
+
+	// Goes up by 2x, making sure that the maximum itself is tested
+	for (size_t t = 1; t <= max_threads; t = (t < max_threads && t*2 > max_threads) ? max_threads : t*2) {
+		for (size_t i = 0; i < sizeof(thread_impls)/sizeof(thread_impls[0]); i++) {
+			if (!only_impl || strcmp(only_impl, thread_impls[i]) == 0) {
+				report_threads_case(thread_impls[i], ops, seed, t);
+			}
+		}
+	}
+
+	for (size_t i = 0; i < sizeof(large_free_impls)/sizeof(large_free_impls[0]); i++) {
+		if (!only_impl || strcmp(only_impl, large_free_impls[i]) == 0) {
+			report_large_free_case(large_free_impls[i], large_ops, seed);
+		}
+	}
+
+	free(region);
+	return 0;
+}
+
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
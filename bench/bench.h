@@ -0,0 +1,294 @@
+/*
+============================================================
+                        BENCH INFO
+
+BENCH NAME:         bench.h
+BENCH WRITTEN BY:   Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        BENCH PURPOSE
+
+This file holds the helpers shared by every muma benchmark:
+allocation counting (hooked in through muma's overridable
+`mu_malloc`/`mu_realloc`/`mu_free` dependencies), timing,
+peak RSS measurement, and JSON Lines output.
+
+Every benchmark prints one JSON object per line to stdout,
+so results can be piped straight into a file (for example,
+`bench_output.txt`) and compared between versions.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain,
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+#ifndef MUMA_BENCH_H
+#define MUMA_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+	#include <sys/resource.h>
+#endif
+#ifdef _WIN32
+	#include <windows.h>
+	#include <psapi.h>
+#endif
+
+/* Allocation counting */
+
+	// Every allocation that goes through muma (and through the
+	// baselines) is counted, so allocations/op can be reported.
+
+	static size_t bench_allocation_count = 0;
+
+	static void* bench_malloc(size_t size) {
+		bench_allocation_count++;
+		return malloc(size);
+	}
+
+	static void* bench_realloc(void* p, size_t size) {
+		bench_allocation_count++;
+		return realloc(p, size);
+	}
+
+	static void bench_free(void* p) {
+		free(p);
+	}
+
+	// Hook muma's allocation dependencies; this must happen before
+	// the inclusion of muma's header.
+
+	#ifndef mu_malloc
+		#define mu_malloc bench_malloc
+	#endif
+	#ifndef mu_realloc
+		#define mu_realloc bench_realloc
+	#endif
+	#ifndef mu_free
+		#define mu_free bench_free
+	#endif
+
+	// std::allocator equivalent that counts allocations, used for
+	// std::vector baselines
+
+	template<typename T>
+	struct bench_allocator {
+		typedef T value_type;
+
+		bench_allocator() {}
+		template<typename U> bench_allocator(const bench_allocator<U>&) {}
+
+		T* allocate(size_t n) {
+			bench_allocation_count++;
+			return static_cast<T*>(malloc(n * sizeof(T)));
+		}
+		void deallocate(T* p, size_t) {
+			free(p);
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(const bench_allocator<T>&, const bench_allocator<U>&) { return true; }
+	template<typename T, typename U>
+	bool operator!=(const bench_allocator<T>&, const bench_allocator<U>&) { return false; }
+
+/* Timing */
+
+	static double bench_now_ns(void) {
+		return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+	}
+
+	// Keeps the compiler from optimizing away a computed value
+
+	static volatile size_t bench_sink = 0;
+	#define BENCH_CONSUME(v) bench_sink += (size_t)(v)
+
+/* Peak RSS */
+
+	// Resets the peak RSS counter if the platform allows it (Linux
+	// 4.0+ through /proc/self/clear_refs), so that each benchmark
+	// case reports its own peak instead of the process-wide one.
+
+	static void bench_reset_peak_rss(void) {
+		#ifdef __linux__
+			FILE* f = fopen("/proc/self/clear_refs", "w");
+			if (f) {
+				fputs("5", f);
+				fclose(f);
+			}
+		#endif
+	}
+
+	// Returns the peak resident set size in KiB, or 0 if unknown.
+
+	static size_t bench_peak_rss_kib(void) {
+		#ifdef __linux__
+			FILE* f = fopen("/proc/self/status", "r");
+			if (f) {
+				char line[256];
+				size_t kib = 0;
+				while (fgets(line, sizeof(line), f)) {
+					if (strncmp(line, "VmHWM:", 6) == 0) {
+						kib = (size_t)strtoull(line+6, 0, 10);
+						break;
+					}
+				}
+				fclose(f);
+				if (kib != 0) {
+					return kib;
+				}
+			}
+		#endif
+
+		#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+			struct rusage usage;
+			if (getrusage(RUSAGE_SELF, &usage) == 0) {
+				#ifdef __APPLE__
+					return (size_t)usage.ru_maxrss / 1024;
+				#else
+					return (size_t)usage.ru_maxrss;
+				#endif
+			}
+		#endif
+
+		#ifdef _WIN32
+			PROCESS_MEMORY_COUNTERS counters;
+			if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+				return (size_t)counters.PeakWorkingSetSize / 1024;
+			}
+		#endif
+
+		return 0;
+	}
+
+/* Output */
+
+	// Builds a single JSON object and prints it as one line.
+
+	class bench_record {
+		std::string text;
+
+		void key(const char* k) {
+			text += (text.size() == 1) ? "\"" : ",\"";
+			text += k;
+			text += "\":";
+		}
+
+	public:
+		bench_record(const char* benchmark) : text("{") {
+			str("benchmark", benchmark);
+		}
+
+		bench_record& str(const char* k, const char* v) {
+			key(k);
+			text += "\"";
+			text += v;
+			text += "\"";
+			return *this;
+		}
+
+		bench_record& num(const char* k, double v) {
+			char buf[64];
+			snprintf(buf, sizeof(buf), "%.3f", v);
+			key(k);
+			text += buf;
+			return *this;
+		}
+
+		bench_record& integer(const char* k, unsigned long long v) {
+			char buf[32];
+			snprintf(buf, sizeof(buf), "%llu", v);
+			key(k);
+			text += buf;
+			return *this;
+		}
+
+		void print(void) {
+			printf("%s}\n", text.c_str());
+			fflush(stdout);
+		}
+	};
+
+/* Command line */
+
+	// Reads "--name value" from the command line, returning
+	// `fallback` if it isn't present.
+
+	static unsigned long long bench_arg(int argc, char** argv, const char* name, unsigned long long fallback) {
+		for (int i = 1; i+1 < argc; i++) {
+			if (strcmp(argv[i], name) == 0) {
+				return strtoull(argv[i+1], 0, 10);
+			}
+		}
+		return fallback;
+	}
+
+	// Reads "--name value" as a string, returning `fallback` if it
+	// isn't present.
+
+	static const char* bench_arg_str(int argc, char** argv, const char* name, const char* fallback) {
+		for (int i = 1; i+1 < argc; i++) {
+			if (strcmp(argv[i], name) == 0) {
+				return argv[i+1];
+			}
+		}
+		return fallback;
+	}
+
+#endif /* MUMA_BENCH_H */
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
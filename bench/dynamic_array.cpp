@@ -0,0 +1,479 @@
+/*
+============================================================
+                        BENCH INFO
+
+BENCH NAME:         dynamic_array.cpp
+BENCH WRITTEN BY:   Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        BENCH PURPOSE
+
+This benchmark measures every operation generated by
+`mu_dynamic_array_declaration` that matters for throughput
+(push, multipush, insert, erase, find, find_push, and
+resize) across element sizes of 1 to 256 bytes and array
+lengths of 10 to 10^8, next to two baselines:
+
+* `vector`: std::vector with a counting allocator.
+* `realloc`: a plain realloc loop with doubling capacity.
+
+Each case prints one JSON object per line with ns/op,
+allocations/op, and peak RSS (in KiB); find and find_push
+cases also print the fraction of keys that were found.
+
+Build and run it from the `bench` folder like so:
+
+g++ -O2 -std=c++11 -I.. dynamic_array.cpp -o dynamic_array
+./dynamic_array > ../bench_output.txt
+
+Options (all optional):
+
+--max-length N   largest array length tested (default 10^8)
+--max-bytes N    skip cases above N bytes (default 2^30)
+--work N         element moves/compares per case for the
+                 O(n) operations (default 2^26)
+--op NAME        only run the given operation
+--impl NAME      only run "muma", "vector", or "realloc"
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain,
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+// Include shared bench helpers (must come before muma)
+#include "bench.h"
+
+// Include muma
+#define MUMA_IMPLEMENTATION
+#include "muMemoryAllocator.h"
+
+#include <vector>
+
+/* Element types */
+
+	// An element of exactly S bytes, filled from an integer key
+
+	template<size_t S>
+	struct elem {
+		unsigned char b[S];
+	};
+
+	template<size_t S>
+	static elem<S> make_elem(size_t key) {
+		elem<S> e;
+		memset(e.b, 0, S);
+		memcpy(e.b, &key, (S < sizeof(key)) ? S : sizeof(key));
+		return e;
+	}
+
+	template<size_t S>
+	static bool elem_equal(const elem<S>& a, const elem<S>& b) {
+		return memcmp(a.b, b.b, S) == 0;
+	}
+
+/* muma implementation */
+
+	// Maps an element size to its muma dynamic array functions
+
+	template<size_t S> struct muma_ops;
+
+	#define BENCH_DECLARE_MUMA(S) \
+		typedef elem<S> elem_##S; \
+		static muBool elem_##S##_comp(elem_##S a, elem_##S b) { return elem_equal<S>(a, b); } \
+		mu_dynamic_array_declaration(arr_##S, elem_##S, arr_##S##_, elem_##S##_comp) \
+		template<> struct muma_ops<S> { \
+			typedef arr_##S arr; \
+			static arr create(mumaResult* r, size_m n) { return arr_##S##_create(r, n); } \
+			static arr destroy(mumaResult* r, arr a) { return arr_##S##_destroy(r, a); } \
+			static arr resize(mumaResult* r, arr a, size_m n) { return arr_##S##_resize(r, a, n); } \
+			static arr push(mumaResult* r, arr a, elem_##S v) { return arr_##S##_push(r, a, v); } \
+			static arr multipush(mumaResult* r, arr a, elem_##S* v, size_m n) { return arr_##S##_multipush(r, a, v, n); } \
+			static arr insert(mumaResult* r, arr a, size_m i, elem_##S v) { return arr_##S##_insert(r, a, i, v); } \
+			static arr erase(mumaResult* r, arr a, size_m i) { return arr_##S##_erase(r, a, i); } \
+			static size_m find(mumaResult* r, arr a, elem_##S v) { return arr_##S##_find(r, a, v); } \
+			static arr find_push(mumaResult* r, arr a, elem_##S v, size_m* i) { return arr_##S##_find_push(r, a, v, i); } \
+		};
+
+	BENCH_DECLARE_MUMA(1)
+	BENCH_DECLARE_MUMA(4)
+	BENCH_DECLARE_MUMA(8)
+	BENCH_DECLARE_MUMA(16)
+	BENCH_DECLARE_MUMA(32)
+	BENCH_DECLARE_MUMA(64)
+	BENCH_DECLARE_MUMA(128)
+	BENCH_DECLARE_MUMA(256)
+
+	template<size_t S>
+	struct muma_impl {
+		typedef elem<S> T;
+		typedef muma_ops<S> ops;
+		typename ops::arr a;
+
+		static const char* name(void) { return "muma"; }
+
+		muma_impl() { a = ops::create(0, 0); }
+		~muma_impl() { a = ops::destroy(0, a); }
+
+		size_t length(void) { return a.length; }
+		void push(const T& v) { a = ops::push(0, a, v); }
+		void multipush(const T* v, size_t n) { a = ops::multipush(0, a, (T*)v, n); }
+		void insert(size_t i, const T& v) { a = ops::insert(0, a, i, v); }
+		void erase(size_t i) { a = ops::erase(0, a, i); }
+		size_t find(const T& v) { return ops::find(0, a, v); }
+		size_t find_push(const T& v) { size_m i = 0; a = ops::find_push(0, a, v, &i); return i; }
+		void resize(size_t n) { a = ops::resize(0, a, n); }
+	};
+
+/* std::vector baseline */
+
+	template<size_t S>
+	struct vector_impl {
+		typedef elem<S> T;
+		std::vector<T, bench_allocator<T> > v;
+
+		static const char* name(void) { return "vector"; }
+
+		size_t length(void) { return v.size(); }
+		void push(const T& e) { v.push_back(e); }
+		void multipush(const T* e, size_t n) { v.insert(v.end(), e, e+n); }
+		void insert(size_t i, const T& e) { v.insert(v.begin()+i, e); }
+		void erase(size_t i) { v.erase(v.begin()+i); }
+		size_t find(const T& e) {
+			for (size_t i = 0; i < v.size(); i++) {
+				if (elem_equal<S>(v[i], e)) {
+					return i;
+				}
+			}
+			return MU_SIZE_MAX;
+		}
+		size_t find_push(const T& e) {
+			size_t i = find(e);
+			if (i != MU_SIZE_MAX) {
+				return i;
+			}
+			v.push_back(e);
+			return v.size()-1;
+		}
+		void resize(size_t n) { v.resize(n); }
+	};
+
+/* Plain realloc baseline */
+
+	template<size_t S>
+	struct realloc_impl {
+		typedef elem<S> T;
+		T* data;
+		size_t len;
+		size_t cap;
+
+		static const char* name(void) { return "realloc"; }
+
+		realloc_impl() : data(0), len(0), cap(0) {}
+		~realloc_impl() { bench_free(data); }
+
+		void reserve(size_t n) {
+			if (n <= cap) {
+				return;
+			}
+			size_t new_cap = (cap == 0) ? 1 : cap;
+			while (new_cap < n) {
+				new_cap *= 2;
+			}
+			data = (T*)bench_realloc(data, new_cap*sizeof(T));
+			cap = new_cap;
+		}
+
+		size_t length(void) { return len; }
+		void push(const T& e) { reserve(len+1); data[len++] = e; }
+		void multipush(const T* e, size_t n) { reserve(len+n); memcpy(&data[len], e, n*sizeof(T)); len += n; }
+		void insert(size_t i, const T& e) {
+			reserve(len+1);
+			memmove(&data[i+1], &data[i], (len-i)*sizeof(T));
+			data[i] = e;
+			len++;
+		}
+		void erase(size_t i) {
+			memmove(&data[i], &data[i+1], (len-i-1)*sizeof(T));
+			len--;
+		}
+		size_t find(const T& e) {
+			for (size_t i = 0; i < len; i++) {
+				if (elem_equal<S>(data[i], e)) {
+					return i;
+				}
+			}
+			return MU_SIZE_MAX;
+		}
+		size_t find_push(const T& e) {
+			size_t i = find(e);
+			if (i != MU_SIZE_MAX) {
+				return i;
+			}
+			push(e);
+			return len-1;
+		}
+		void resize(size_t n) {
+			reserve(n);
+			if (n > len) {
+				memset(&data[len], 0, (n-len)*sizeof(T));
+			}
+			len = n;
+		}
+	};
+
+/* Cases */
+
+	// Global settings read from the command line
+
+	static size_t work_budget = (size_t)1 << 26;
+
+	// How many of the timed find/find_push calls found their key,
+	// reported as the case's hit rate
+	static size_t find_hits = 0;
+
+	// Fills an array with `n` distinct elements (untimed). This is
+	// done in small chunks so that no copy of the whole array exists,
+	// and the peak RSS is reset afterwards, so that growing the array
+	// here doesn't count towards the peak of the measured run.
+
+	template<class Impl>
+	static void prefill(Impl& a, size_t n) {
+		typedef typename Impl::T T;
+		const size_t chunk = 64;
+		T buf[chunk];
+		for (size_t i = 0; i < n; i += chunk) {
+			size_t count = (n-i < chunk) ? n-i : chunk;
+			for (size_t j = 0; j < count; j++) {
+				buf[j] = make_elem<sizeof(T)>(i+j);
+			}
+			a.multipush(buf, count);
+		}
+		bench_reset_peak_rss();
+	}
+
+	// Number of O(n) operations that fit in the work budget for an
+	// array of length `n`
+
+	static size_t linear_ops(size_t n) {
+		size_t ops = work_budget / (n == 0 ? 1 : n);
+		if (ops < 1) ops = 1;
+		if (ops > 100000) ops = 100000;
+		return ops;
+	}
+
+	// Runs operation `op` on a fresh array of length `n`, and fills
+	// in how many operations were timed.
+
+	template<class Impl>
+	static double run_case(const char* op, size_t n, size_t* ops) {
+		typedef typename Impl::T T;
+		const size_t S = sizeof(T);
+		Impl a;
+		double begin = 0.0, end = 0.0;
+
+		if (strcmp(op, "push") == 0) {
+			begin = bench_now_ns();
+			for (size_t i = 0; i < n; i++) {
+				a.push(make_elem<S>(i));
+			}
+			end = bench_now_ns();
+			*ops = n;
+		}
+
+		else if (strcmp(op, "multipush") == 0) {
+			const size_t chunk = 64;
+			T buf[chunk];
+			for (size_t i = 0; i < chunk; i++) {
+				buf[i] = make_elem<S>(i);
+			}
+			*ops = 0;
+			begin = bench_now_ns();
+			for (size_t i = 0; i < n; i += chunk) {
+				a.multipush(buf, (n-i < chunk) ? n-i : chunk);
+				(*ops)++;
+			}
+			end = bench_now_ns();
+		}
+
+		else if (strcmp(op, "insert") == 0) {
+			prefill(a, n);
+			*ops = linear_ops(n);
+			bench_allocation_count = 0;
+			begin = bench_now_ns();
+			for (size_t i = 0; i < *ops; i++) {
+				a.insert(a.length()/2, make_elem<S>(i));
+			}
+			end = bench_now_ns();
+		}
+
+		else if (strcmp(op, "erase") == 0) {
+			prefill(a, n);
+			*ops = linear_ops(n);
+			if (*ops > n) *ops = n;
+			bench_allocation_count = 0;
+			begin = bench_now_ns();
+			for (size_t i = 0; i < *ops; i++) {
+				a.erase(a.length()/2);
+			}
+			end = bench_now_ns();
+		}
+
+		else if (strcmp(op, "find") == 0) {
+			prefill(a, n);
+			*ops = linear_ops(n);
+			bench_allocation_count = 0;
+			begin = bench_now_ns();
+			for (size_t i = 0; i < *ops; i++) {
+				// Keys are spread over [0, 2n), so about half are missing
+				// when the element can hold 2n distinct keys; smaller
+				// elements truncate the key (1-byte elements repeat every
+				// 256 keys, so nearly all of them hit), which is why the
+				// measured hit rate is reported alongside.
+				size_t index = a.find(make_elem<S>((i*7919) % (2*n)));
+				find_hits += (index != MU_SIZE_MAX) ? 1 : 0;
+				BENCH_CONSUME(index);
+			}
+			end = bench_now_ns();
+		}
+
+		else if (strcmp(op, "find_push") == 0) {
+			prefill(a, n);
+			*ops = linear_ops(n);
+			bench_allocation_count = 0;
+			begin = bench_now_ns();
+			for (size_t i = 0; i < *ops; i++) {
+				size_t length = a.length();
+				BENCH_CONSUME(a.find_push(make_elem<S>((i*7919) % (2*n))));
+				find_hits += (a.length() == length) ? 1 : 0;
+			}
+			end = bench_now_ns();
+		}
+
+		else if (strcmp(op, "resize") == 0) {
+			// Alternates between the full and a quarter length, which
+			// crosses capacity boundaries in both directions
+			*ops = 2*linear_ops(n);
+			begin = bench_now_ns();
+			for (size_t i = 0; i < *ops; i += 2) {
+				a.resize(n);
+				a.resize(n/4);
+			}
+			end = bench_now_ns();
+		}
+
+		return end - begin;
+	}
+
+	template<class Impl>
+	static void report_case(const char* op, size_t n) {
+		typedef typename Impl::T T;
+		size_t ops = 0;
+
+		bench_reset_peak_rss();
+		bench_allocation_count = 0;
+		find_hits = 0;
+		double ns = run_case<Impl>(op, n, &ops);
+		size_t allocations = bench_allocation_count;
+		if (ops == 0) ops = 1;
+
+		bench_record record("dynamic_array");
+		record.str("op", op)
+			.str("impl", Impl::name())
+			.integer("element_size", sizeof(T))
+			.integer("length", n)
+			.integer("ops", ops)
+			.num("ns_per_op", ns / (double)ops)
+			.num("allocations_per_op", (double)allocations / (double)ops)
+			.integer("peak_rss_kib", bench_peak_rss_kib());
+		if (strcmp(op, "find") == 0 || strcmp(op, "find_push") == 0) {
+			record.num("hit_rate", (double)find_hits / (double)ops);
+		}
+		record.print();
+	}
+
+	template<size_t S>
+	static void run_size(const char* only_op, const char* only_impl, size_t max_length, size_t max_bytes) {
+		static const char* ops[] = { "push", "multipush", "insert", "erase", "find", "find_push", "resize" };
+
+		for (size_t n = 10; n <= max_length; n *= 10) {
+			if (n*S > max_bytes) {
+				break;
+			}
+			for (size_t o = 0; o < sizeof(ops)/sizeof(ops[0]); o++) {
+				if (only_op && strcmp(only_op, ops[o]) != 0) {
+					continue;
+				}
+				if (!only_impl || strcmp(only_impl, "muma") == 0)    report_case<muma_impl<S> >(ops[o], n);
+				if (!only_impl || strcmp(only_impl, "vector") == 0)  report_case<vector_impl<S> >(ops[o], n);
+				if (!only_impl || strcmp(only_impl, "realloc") == 0) report_case<realloc_impl<S> >(ops[o], n);
+			}
+		}
+	}
+
+int main(int argc, char** argv) {
+	size_t max_length = (size_t)bench_arg(argc, argv, "--max-length", 100000000ULL);
+	size_t max_bytes = (size_t)bench_arg(argc, argv, "--max-bytes", 1ULL << 30);
+	work_budget = (size_t)bench_arg(argc, argv, "--work", work_budget);
+	const char* only_op = bench_arg_str(argc, argv, "--op", 0);
+	const char* only_impl = bench_arg_str(argc, argv, "--impl", 0);
+
+	run_size<1>(only_op, only_impl, max_length, max_bytes);
+	run_size<4>(only_op, only_impl, max_length, max_bytes);
+	run_size<8>(only_op, only_impl, max_length, max_bytes);
+	run_size<16>(only_op, only_impl, max_length, max_bytes);
+	run_size<32>(only_op, only_impl, max_length, max_bytes);
+	run_size<64>(only_op, only_impl, max_length, max_bytes);
+	run_size<128>(only_op, only_impl, max_length, max_bytes);
+	run_size<256>(only_op, only_impl, max_length, max_bytes);
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,214 @@
+/*
+============================================================
+                        BENCH INFO
+
+BENCH NAME:         sort.cpp
+BENCH WRITTEN BY:   Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        BENCH PURPOSE
+
+This benchmark sorts random `uint32_m` keys with muma's
+generated introsort and radix sort, compared against `qsort`
+and `std::sort` on the same data. It also measures how
+muma's parallel sort and parallel merge (of 64 sorted
+arrays) scale with 1, 2, 4, ... threads.
+
+Each case prints one JSON object per line with the total
+time, ns per key, thread count, and peak RSS (in KiB).
+
+Build and run it from the `bench` folder like so:
+
+g++ -O2 -std=c++11 -pthread -I.. sort.cpp -o sort
+./sort > ../bench_output.txt
+
+Options (all optional):
+
+--max-length N   largest amount of keys (default 5*10^7)
+--seed N         seed of the random keys (default 1)
+--threads N      most threads for the parallel cases
+                 (default: the amount of hardware threads)
+--impl NAME      only run "qsort", "std_sort", "muma_sort",
+                 "muma_radix_sort", "muma_parallel_sort",
+                 or "muma_parallel_merge"
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain,
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+// Include shared bench helpers (must come before muma)
+#include "bench.h"
+
+// Include muma
+#define MUMA_IMPLEMENTATION
+#include "muMemoryAllocator.h"
+
+#include <algorithm>
+
+/* Declarations */
+
+	static muBool key_equal(uint32_m a, uint32_m b) { return a == b; }
+	#define key_less(a, b) ((a) < (b))
+	#define key_radix(a) ((uint64_m)(a))
+
+	mu_dynamic_array_declaration(key_array, uint32_m, key_array_, key_equal)
+	mu_dynamic_array_sort_declaration(key_array, uint32_m, key_array_, key_less)
+	mu_dynamic_array_radix_sort_declaration(key_array, uint32_m, key_array_, key_radix)
+	mu_dynamic_array_parallel_sort_declaration(key_array, uint32_m, key_array_, key_less)
+
+	static int key_compare(const void* a, const void* b) {
+		uint32_m x = *(const uint32_m*)a;
+		uint32_m y = *(const uint32_m*)b;
+		return (x > y) - (x < y);
+	}
+
+/* Cases */
+
+	// xorshift64*, so every implementation sorts the same keys
+	static void fill_keys(key_array a, uint64_m seed) {
+		uint64_m x = seed*2654435761ULL + 1;
+		for (size_m i = 0; i < a.length; i++) {
+			x ^= x >> 12;
+			x ^= x << 25;
+			x ^= x >> 27;
+			a.data[i] = (uint32_m)((x * 2685821657736338717ULL) >> 32);
+		}
+	}
+
+	// Amount of sorted arrays merged by the parallel merge case
+	#define MERGE_RUNS 64
+
+	static void report_case(const char* impl, size_t n, uint64_m seed, size_t threads) {
+		key_array a = key_array_create(0, n);
+		fill_keys(a, seed);
+
+		// The merge case merges MERGE_RUNS sorted slices of the keys
+		key_array runs[MERGE_RUNS];
+		const bool merge = strcmp(impl, "muma_parallel_merge") == 0;
+		if (merge) {
+			for (size_t r = 0; r < MERGE_RUNS; r++) {
+				size_t begin = (r*n)/MERGE_RUNS;
+				runs[r] = key_array_create(0, ((r+1)*n)/MERGE_RUNS - begin);
+				memcpy(runs[r].data, &a.data[begin], runs[r].length*sizeof(uint32_m));
+				runs[r] = key_array_sort(0, runs[r]);
+			}
+			a = key_array_destroy(0, a);
+		}
+
+		bench_reset_peak_rss();
+		bench_allocation_count = 0;
+		double begin = bench_now_ns();
+		if (merge) {
+			a = key_array_parallel_merge(0, runs, MERGE_RUNS, threads);
+		} else if (strcmp(impl, "muma_parallel_sort") == 0) {
+			a = key_array_parallel_sort(0, a, threads);
+		} else if (strcmp(impl, "qsort") == 0) {
+			qsort(a.data, a.length, sizeof(uint32_m), key_compare);
+		} else if (strcmp(impl, "std_sort") == 0) {
+			std::sort(a.data, a.data + a.length);
+		} else if (strcmp(impl, "muma_sort") == 0) {
+			a = key_array_sort(0, a);
+		} else {
+			a = key_array_radix_sort(0, a);
+		}
+		double end = bench_now_ns();
+		size_t allocations = bench_allocation_count;
+
+		bench_record("sort")
+			.str("impl", impl)
+			.integer("length", n)
+			.integer("threads", threads)
+			.num("ms", (end - begin) / 1e6)
+			.num("ns_per_key", (end - begin) / (double)n)
+			.integer("allocations", allocations)
+			.integer("sorted", key_array_is_sorted(a) ? 1 : 0)
+			.integer("peak_rss_kib", bench_peak_rss_kib())
+			.print();
+
+		a = key_array_destroy(0, a);
+		if (merge) {
+			for (size_t r = 0; r < MERGE_RUNS; r++) {
+				runs[r] = key_array_destroy(0, runs[r]);
+			}
+		}
+	}
+
+int main(int argc, char** argv) {
+	size_t max_length = (size_t)bench_arg(argc, argv, "--max-length", 50000000ULL);
+	uint64_m seed = (uint64_m)bench_arg(argc, argv, "--seed", 1);
+	size_t max_threads = (size_t)bench_arg(argc, argv, "--threads", muma_thread_count());
+	const char* only_impl = bench_arg_str(argc, argv, "--impl", 0);
+
+	static const char* impls[] = { "qsort", "std_sort", "muma_sort", "muma_radix_sort" };
+	static const char* parallel_impls[] = { "muma_parallel_sort", "muma_parallel_merge" };
+
+	// Goes up by 10x (and by 2x for threads), making sure that the
+	// maximum itself is tested
+	for (size_t n = 1000; n <= max_length; n = (n < max_length && n*10 > max_length) ? max_length : n*10) {
+		for (size_t i = 0; i < sizeof(impls)/sizeof(impls[0]); i++) {
+			if (!only_impl || strcmp(only_impl, impls[i]) == 0) {
+				report_case(impls[i], n, seed, 1);
+			}
+		}
+		for (size_t i = 0; i < sizeof(parallel_impls)/sizeof(parallel_impls[0]); i++) {
+			if (only_impl && strcmp(only_impl, parallel_impls[i]) != 0) {
+				continue;
+			}
+			for (size_t t = 1; t <= max_threads; t = (t < max_threads && t*2 > max_threads) ? max_threads : t*2) {
+				report_case(parallel_impls[i], n, seed, t);
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
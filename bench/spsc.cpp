@@ -0,0 +1,370 @@
+/*
+============================================================
+                        BENCH INFO
+
+BENCH NAME:         spsc.cpp
+BENCH WRITTEN BY:   Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        BENCH PURPOSE
+
+This benchmark passes `uint64_m` records from a producer
+thread to a consumer thread through muma's SPSC ring,
+compared against the same ring protected by a mutex (which
+is what a mutex-protected array used as a queue amounts to).
+Both threads are pinned to their own CPU where the platform
+allows it (Linux only).
+
+There are two workloads:
+
+"throughput": the producer pushes every record as fast as
+it can, one at a time ("batch" of 1) or `--batch` at a time
+with `push_n`/`pop_n`, and the consumer pops them and checks
+that they arrive in order.
+
+"latency": the two threads play ping-pong through two rings,
+one record at a time, measuring every round trip.
+
+Each case prints one JSON object per line with the
+throughput (or the 50th, 99th, and 99.9th percentile and
+maximum round trip, in ns), whether or not both threads were
+pinned (and to which CPUs), and peak RSS (in KiB).
+
+Note that the threads spin while the ring is empty or full,
+yielding every so often, so on a machine with a single CPU
+the results mostly measure the scheduler.
+
+Build and run it from the `bench` folder like so:
+
+g++ -O2 -std=c++11 -pthread -I.. spsc.cpp -o spsc
+./spsc > ../bench_output.txt
+
+Options (all optional):
+
+--ops N           amount of records per throughput case
+                  (default 10^7)
+--round-trips N   amount of round trips per latency case
+                  (default 10^5)
+--capacity N      capacity of the rings (default 1024)
+--batch N         batch size of the batched throughput
+                  case (default 64)
+--producer-cpu N  CPU the producer is pinned to (default 0)
+--consumer-cpu N  CPU the consumer is pinned to (default 1,
+                  wrapped to the amount of CPUs)
+--impl NAME       only run "mutex" or "muma_spsc_ring"
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain,
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+// Include shared bench helpers (must come before muma)
+#include "bench.h"
+
+// Include muma
+#define MUMA_IMPLEMENTATION
+#include "muMemoryAllocator.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+/* Declarations */
+
+	mu_spsc_ring_declaration(u64_ring, uint64_m, u64_ring_)
+
+	// The baseline: the same ring, but every operation takes a lock,
+	// so it's safe with any amount of threads.
+	struct locked_ring {
+		u64_ring ring;
+		std::mutex lock;
+	};
+
+	// Both implementations behind the same calls, chosen at runtime
+
+	struct queue {
+		bool locked;
+		u64_ring ring;
+		locked_ring* lr;
+	};
+
+	static bool queue_create(queue* q, const char* impl, size_t capacity) {
+		q->locked = strcmp(impl, "mutex") == 0;
+		mumaResult result;
+		if (q->locked) {
+			q->lr = new locked_ring;
+			q->lr->ring = u64_ring_create(&result, capacity);
+		} else {
+			q->lr = 0;
+			q->ring = u64_ring_create(&result, capacity);
+		}
+		return result == MUMA_SUCCESS;
+	}
+
+	static void queue_destroy(queue* q) {
+		if (q->locked) {
+			u64_ring_destroy(0, &q->lr->ring);
+			delete q->lr;
+		} else {
+			u64_ring_destroy(0, &q->ring);
+		}
+	}
+
+	static size_t queue_push_n(queue* q, const uint64_m* values, size_t count) {
+		if (q->locked) {
+			std::lock_guard<std::mutex> guard(q->lr->lock);
+			return u64_ring_push_n(&q->lr->ring, values, count);
+		}
+		if (count == 1) {
+			return u64_ring_push(&q->ring, values[0]) ? 1 : 0;
+		}
+		return u64_ring_push_n(&q->ring, values, count);
+	}
+
+	static size_t queue_pop_n(queue* q, uint64_m* values, size_t count) {
+		if (q->locked) {
+			std::lock_guard<std::mutex> guard(q->lr->lock);
+			return u64_ring_pop_n(&q->lr->ring, values, count);
+		}
+		if (count == 1) {
+			return u64_ring_pop(&q->ring, values) ? 1 : 0;
+		}
+		return u64_ring_pop_n(&q->ring, values, count);
+	}
+
+/* Threads */
+
+	// Returns the CPU the calling thread was pinned to, or -1
+	static long pin_thread(size_t cpu) {
+		#ifdef __linux__
+			cpu %= (size_t)muma_thread_count();
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+			if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+				return (long)cpu;
+			}
+		#else
+			(void)cpu;
+		#endif
+		return -1;
+	}
+
+	// Spins, yielding every so often so that a single CPU still
+	// makes progress
+	static void backoff(size_t* spins) {
+		if (++*spins % 64 == 0) {
+			std::this_thread::yield();
+		}
+	}
+
+/* Cases */
+
+	static void report_throughput_case(const char* impl, size_t ops, size_t capacity, size_t batch, size_t producer_cpu, size_t consumer_cpu) {
+		queue q;
+		if (!queue_create(&q, impl, capacity)) {
+			return;
+		}
+
+		long pinned_producer = -1;
+		bool in_order = true;
+		bench_reset_peak_rss();
+		double begin = bench_now_ns();
+
+		std::thread producer([&]() {
+			pinned_producer = pin_thread(producer_cpu);
+			std::vector<uint64_m> values(batch);
+			size_t spins = 0;
+			for (size_t i = 0; i < ops;) {
+				size_t count = std::min(batch, ops - i);
+				for (size_t j = 0; j < count; j++) {
+					values[j] = (uint64_m)(i + j);
+				}
+				size_t pushed = 0;
+				while (pushed < count) {
+					size_t n = queue_push_n(&q, &values[pushed], count - pushed);
+					if (n == 0) {
+						backoff(&spins);
+					}
+					pushed += n;
+				}
+				i += count;
+			}
+		});
+
+		long pinned_consumer = pin_thread(consumer_cpu);
+		std::vector<uint64_m> values(batch);
+		size_t spins = 0;
+		for (size_t i = 0; i < ops;) {
+			size_t n = queue_pop_n(&q, &values[0], batch);
+			if (n == 0) {
+				backoff(&spins);
+			}
+			for (size_t j = 0; j < n; j++) {
+				in_order &= values[j] == (uint64_m)(i + j);
+			}
+			i += n;
+		}
+		producer.join();
+		double end = bench_now_ns();
+
+		bench_record("spsc")
+			.str("impl", impl)
+			.str("workload", "throughput")
+			.integer("ops", ops)
+			.integer("batch", batch)
+			.integer("capacity", capacity)
+			.num("mops_per_s", (double)ops / ((end - begin) / 1e3))
+			.num("ns_per_op", (end - begin) / (double)ops)
+			.integer("in_order", in_order ? 1 : 0)
+			.integer("pinned", (pinned_producer >= 0 && pinned_consumer >= 0) ? 1 : 0)
+			.integer("producer_cpu", pinned_producer >= 0 ? (size_t)pinned_producer : 0)
+			.integer("consumer_cpu", pinned_consumer >= 0 ? (size_t)pinned_consumer : 0)
+			.integer("peak_rss_kib", bench_peak_rss_kib())
+			.print();
+		queue_destroy(&q);
+	}
+
+	static double percentile(const std::vector<float>& sorted, double p) {
+		size_t i = (size_t)(p * (double)(sorted.size() - 1));
+		return (double)sorted[i];
+	}
+
+	static void report_latency_case(const char* impl, size_t round_trips, size_t capacity, size_t producer_cpu, size_t consumer_cpu) {
+		queue ping, pong;
+		if (!queue_create(&ping, impl, capacity)) {
+			return;
+		}
+		if (!queue_create(&pong, impl, capacity)) {
+			queue_destroy(&ping);
+			return;
+		}
+
+		long pinned_echo = -1;
+		bench_reset_peak_rss();
+		std::thread echo([&]() {
+			pinned_echo = pin_thread(consumer_cpu);
+			size_t spins = 0;
+			for (size_t i = 0; i < round_trips; i++) {
+				uint64_m v;
+				while (queue_pop_n(&ping, &v, 1) == 0) {
+					backoff(&spins);
+				}
+				while (queue_push_n(&pong, &v, 1) == 0) {
+					backoff(&spins);
+				}
+			}
+		});
+
+		long pinned_main = pin_thread(producer_cpu);
+		std::vector<float> latencies;
+		latencies.reserve(round_trips);
+		size_t spins = 0;
+		for (size_t i = 0; i < round_trips; i++) {
+			uint64_m v = (uint64_m)i;
+			double t = bench_now_ns();
+			while (queue_push_n(&ping, &v, 1) == 0) {
+				backoff(&spins);
+			}
+			while (queue_pop_n(&pong, &v, 1) == 0) {
+				backoff(&spins);
+			}
+			latencies.push_back((float)(bench_now_ns() - t));
+		}
+		echo.join();
+
+		std::sort(latencies.begin(), latencies.end());
+		bench_record("spsc")
+			.str("impl", impl)
+			.str("workload", "latency")
+			.integer("round_trips", round_trips)
+			.num("p50_ns", percentile(latencies, 0.5))
+			.num("p99_ns", percentile(latencies, 0.99))
+			.num("p999_ns", percentile(latencies, 0.999))
+			.num("max_ns", (double)latencies.back())
+			.integer("pinned", (pinned_main >= 0 && pinned_echo >= 0) ? 1 : 0)
+			.integer("producer_cpu", pinned_main >= 0 ? (size_t)pinned_main : 0)
+			.integer("consumer_cpu", pinned_echo >= 0 ? (size_t)pinned_echo : 0)
+			.integer("peak_rss_kib", bench_peak_rss_kib())
+			.print();
+		queue_destroy(&ping);
+		queue_destroy(&pong);
+	}
+
+int main(int argc, char** argv) {
+	size_t ops = (size_t)bench_arg(argc, argv, "--ops", 10000000ULL);
+	size_t round_trips = (size_t)bench_arg(argc, argv, "--round-trips", 100000ULL);
+	size_t capacity = (size_t)bench_arg(argc, argv, "--capacity", 1024);
+	size_t batch = (size_t)bench_arg(argc, argv, "--batch", 64);
+	size_t producer_cpu = (size_t)bench_arg(argc, argv, "--producer-cpu", 0);
+	size_t consumer_cpu = (size_t)bench_arg(argc, argv, "--consumer-cpu", 1);
+	const char* only_impl = bench_arg_str(argc, argv, "--impl", 0);
+
+	static const char* impls[] = { "mutex", "muma_spsc_ring" };
+
+	for (size_t i = 0; i < sizeof(impls)/sizeof(impls[0]); i++) {
+		if (only_impl && strcmp(only_impl, impls[i]) != 0) {
+			continue;
+		}
+		report_throughput_case(impls[i], ops, capacity, 1, producer_cpu, consumer_cpu);
+		report_throughput_case(impls[i], ops, capacity, batch, producer_cpu, consumer_cpu);
+		report_latency_case(impls[i], round_trips, capacity, producer_cpu, consumer_cpu);
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,158 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          budget.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to cap the memory of a single tenant
+with a memory budget: the budget is set on the thread's
+allocator, and a push that would take the tenant over its
+hard limit is refused with MUMA_BUDGET_EXCEEDED, while
+arrays outside of the tenant are unaffected.
+
+The demo returns 1 if anything doesn't behave as described.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+// Include muma
+#define MUMA_NAMES // (for muma_result_get_name)
+#define MUMA_IMPLEMENTATION
+#include "muMemoryAllocator.h"
+
+// Include stdio for printing
+#include <stdio.h>
+
+/* Create a dynamic byte array */
+
+muBool byte_comp(muByte b0, muByte b1) {
+	return b0 == b1;
+}
+
+mu_dynamic_array_declaration(byte_arr, muByte, byte_arr_, byte_comp)
+
+int main(void) {
+	mumaResult result;
+
+	/* Set up the tenant's budget */
+
+		// Give the tenant a hard limit of 64 KiB (and no soft limit);
+		// its parent is the global budget, since 0 is passed.
+
+		mumaBudget tenant = muma_budget_create(0, 64*1024, 0, 0, 0);
+
+		// Count everything allocated on this thread against the tenant,
+		// still allocating with mu_malloc & co.
+
+		mumaAllocator allocator = muma_get_allocator();
+		allocator.budget = &tenant;
+		mumaAllocator previous = muma_set_allocator(&allocator);
+
+	/* Use an array within the budget */
+
+		byte_arr bytes = byte_arr_create(&result, 1024);
+		printf("Created a 1 KiB array: %s\n", muma_result_get_name(result));
+		printf("Tenant usage: %zu bytes, global usage: %zu bytes\n",
+			(size_t)muma_budget_get_usage(&tenant), (size_t)muma_budget_get_usage(0));
+		if (result != MUMA_SUCCESS) {
+			return 1;
+		}
+
+	/* Push more than the budget allows */
+
+		// Pushing 100 KiB would take the tenant over 64 KiB, so the push
+		// is refused and the array is left as it was.
+
+		static muByte chunk[100*1024];
+		bytes = byte_arr_multipush(&result, bytes, chunk, sizeof(chunk));
+		printf("Pushed 100 KiB: %s (length is still %zu)\n", muma_result_get_name(result), (size_t)bytes.length);
+		if (result != MUMA_BUDGET_EXCEEDED || bytes.length != 1024) {
+			return 1;
+		}
+
+		bytes = byte_arr_destroy(&result, bytes);
+		printf("Tenant usage after destroying: %zu bytes\n", (size_t)muma_budget_get_usage(&tenant));
+		if (muma_budget_get_usage(&tenant) != 0) {
+			return 1;
+		}
+
+	/* Allocate outside of the tenant */
+
+		// With the previous allocator back, only the (unlimited) global
+		// budget is used, so the same push succeeds.
+
+		muma_set_allocator(&previous);
+
+		bytes = byte_arr_create(&result, 1024);
+		bytes = byte_arr_multipush(&result, bytes, chunk, sizeof(chunk));
+		printf("Pushed 100 KiB outside of the tenant: %s\n", muma_result_get_name(result));
+		if (result != MUMA_SUCCESS) {
+			return 1;
+		}
+		bytes = byte_arr_destroy(&result, bytes);
+
+	/* Possible output:
+	Created a 1 KiB array: MUMA_SUCCESS
+	Tenant usage: 1024 bytes, global usage: 1024 bytes
+	Pushed 100 KiB: MUMA_BUDGET_EXCEEDED (length is still 1024)
+	Tenant usage after destroying: 0 bytes
+	Pushed 100 KiB outside of the tenant: MUMA_SUCCESS
+	*/
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
@@ -27,6 +27,10 @@ More information about the general structure of a mu library is provided at [the
 
 Demos that quickly show the gist of the library and how it works are available in the `demos` folder.
 
+# Benchmarks
+
+Benchmarks that measure the library's performance against common baselines are available in the `bench` folder. Each benchmark prints its results as JSON Lines (one JSON object per line), and lists how to build and run it at the top of its file.
+
 # Licensing
 
 muma is licensed under public domain or MIT, whichever you prefer. More information is provided in the accompanying file `license.md` and at the bottom of `muMemoryAllocator.h`.
@@ -460,6 +464,187 @@ Note that mu libraries store their dependencies within their files, so you don't
 
 		#endif
 
+	/* Inline (internal) */
+
+		#ifndef MUMA_INLINE
+			#if defined(_MSC_VER) && !defined(__cplusplus)
+				#define MUMA_INLINE __inline
+			#else
+				#define MUMA_INLINE inline
+			#endif
+		#endif
+
+	/* Atomic operations (internal) */
+
+		// These are used to keep shared counters (such as memory budget
+		// usage) correct across threads. They can be overridden by
+		// defining them before the inclusion of the header.
+
+		// `MUMA_ATOMIC_CAS_PTR(p, expected, desired)` and
+		// `MUMA_ATOMIC_EXCHANGE_PTR(p, v)` work on a `void*` variable
+		// pointed to by `p`, with the former evaluating to whether or not
+		// the swap happened.
+
+		// `MUMA_ATOMIC_LOAD_ACQUIRE(p)` and `MUMA_ATOMIC_STORE_RELEASE(p, v)`
+		// are weaker than the rest, for a single writer publishing data to
+		// a single reader without a full barrier.
+
+		#if !defined(MUMA_ATOMIC_ADD_FETCH) || \
+			!defined(MUMA_ATOMIC_SUB_FETCH) || \
+			!defined(MUMA_ATOMIC_LOAD)      || \
+			!defined(MUMA_ATOMIC_CAS_PTR)   || \
+			!defined(MUMA_ATOMIC_EXCHANGE_PTR) || \
+			!defined(MUMA_ATOMIC_LOAD_ACQUIRE) || \
+			!defined(MUMA_ATOMIC_STORE_RELEASE)
+
+			#if defined(__GNUC__) || defined(__clang__)
+
+				#ifndef MUMA_ATOMIC_ADD_FETCH
+					#define MUMA_ATOMIC_ADD_FETCH(p, v) __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+				#endif
+				#ifndef MUMA_ATOMIC_SUB_FETCH
+					#define MUMA_ATOMIC_SUB_FETCH(p, v) __atomic_sub_fetch((p), (v), __ATOMIC_SEQ_CST)
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD
+					#define MUMA_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+				#endif
+				#ifndef MUMA_ATOMIC_CAS_PTR
+					#define MUMA_ATOMIC_CAS_PTR(p, expected, desired) __sync_bool_compare_and_swap((p), (expected), (desired))
+				#endif
+				#ifndef MUMA_ATOMIC_EXCHANGE_PTR
+					#define MUMA_ATOMIC_EXCHANGE_PTR(p, v) __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD_ACQUIRE
+					#define MUMA_ATOMIC_LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+				#endif
+				#ifndef MUMA_ATOMIC_STORE_RELEASE
+					#define MUMA_ATOMIC_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+				#endif
+
+			#elif defined(_MSC_VER)
+
+				#include <intrin.h>
+
+				#ifdef _WIN64
+					#ifndef MUMA_ATOMIC_ADD_FETCH
+						#define MUMA_ATOMIC_ADD_FETCH(p, v) ((size_m)_InterlockedExchangeAdd64((volatile __int64*)(p), (__int64)(v)) + (size_m)(v))
+					#endif
+					#ifndef MUMA_ATOMIC_SUB_FETCH
+						#define MUMA_ATOMIC_SUB_FETCH(p, v) ((size_m)_InterlockedExchangeAdd64((volatile __int64*)(p), -(__int64)(v)) - (size_m)(v))
+					#endif
+				#else
+					#ifndef MUMA_ATOMIC_ADD_FETCH
+						#define MUMA_ATOMIC_ADD_FETCH(p, v) ((size_m)_InterlockedExchangeAdd((volatile long*)(p), (long)(v)) + (size_m)(v))
+					#endif
+					#ifndef MUMA_ATOMIC_SUB_FETCH
+						#define MUMA_ATOMIC_SUB_FETCH(p, v) ((size_m)_InterlockedExchangeAdd((volatile long*)(p), -(long)(v)) - (size_m)(v))
+					#endif
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD
+					#define MUMA_ATOMIC_LOAD(p) (*(volatile size_m*)(p))
+				#endif
+				#ifndef MUMA_ATOMIC_CAS_PTR
+					#define MUMA_ATOMIC_CAS_PTR(p, expected, desired) (_InterlockedCompareExchangePointer((void* volatile*)(p), (desired), (expected)) == (expected))
+				#endif
+				#ifndef MUMA_ATOMIC_EXCHANGE_PTR
+					#define MUMA_ATOMIC_EXCHANGE_PTR(p, v) _InterlockedExchangePointer((void* volatile*)(p), (v))
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD_ACQUIRE
+					#define MUMA_ATOMIC_LOAD_ACQUIRE(p) (*(volatile size_m*)(p))
+				#endif
+				#ifndef MUMA_ATOMIC_STORE_RELEASE
+					#define MUMA_ATOMIC_STORE_RELEASE(p, v) (*(volatile size_m*)(p) = (v))
+				#endif
+
+			#else
+
+				// No known atomic support; these are NOT thread-safe.
+				#ifndef MUMA_ATOMIC_ADD_FETCH
+					#define MUMA_ATOMIC_ADD_FETCH(p, v) (*(p) += (v))
+				#endif
+				#ifndef MUMA_ATOMIC_SUB_FETCH
+					#define MUMA_ATOMIC_SUB_FETCH(p, v) (*(p) -= (v))
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD
+					#define MUMA_ATOMIC_LOAD(p) (*(p))
+				#endif
+				#ifndef MUMA_ATOMIC_CAS_PTR
+					#define MUMA_ATOMIC_CAS_PTR(p, expected, desired) ((*(p) == (expected)) ? (*(p) = (desired), 1) : 0)
+				#endif
+				#ifndef MUMA_ATOMIC_LOAD_ACQUIRE
+					#define MUMA_ATOMIC_LOAD_ACQUIRE(p) (*(p))
+				#endif
+				#ifndef MUMA_ATOMIC_STORE_RELEASE
+					#define MUMA_ATOMIC_STORE_RELEASE(p, v) (*(p) = (v))
+				#endif
+				#ifndef MUMA_ATOMIC_EXCHANGE_PTR
+					#define MUMA_ATOMIC_EXCHANGE_PTR(p, v) muma_inner_exchange_ptr((p), (v))
+					static MUMA_INLINE void* muma_inner_exchange_ptr(void** p, void* v) {
+						void* old = *p;
+						*p = v;
+						return old;
+					}
+				#endif
+
+			#endif
+
+		#endif
+
+	/* Bit operations (internal) */
+
+		// `MUMA_POPCOUNT64(x)` is the amount of set bits in the 64-bit
+		// value `x`, and `MUMA_CTZ64(x)` is the index of its lowest set
+		// bit (`x` must not be 0). Both can be overridden by defining
+		// them before the inclusion of the header.
+
+		static MUMA_INLINE size_m muma_popcount64_fallback(uint64_m x) {
+			x = x - ((x >> 1) & 0x5555555555555555ULL);
+			x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+			x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			return (size_m)((x * 0x0101010101010101ULL) >> 56);
+		}
+
+		static MUMA_INLINE size_m muma_ctz64_fallback(uint64_m x) {
+			size_m n = 0;
+			while ((x & 1) == 0) {
+				x >>= 1;
+				n++;
+			}
+			return n;
+		}
+
+		#if defined(__GNUC__) || defined(__clang__)
+			#ifndef MUMA_POPCOUNT64
+				#define MUMA_POPCOUNT64(x) ((size_m)__builtin_popcountll(x))
+			#endif
+			#ifndef MUMA_CTZ64
+				#define MUMA_CTZ64(x) ((size_m)__builtin_ctzll(x))
+			#endif
+		#else
+			#ifndef MUMA_POPCOUNT64
+				#define MUMA_POPCOUNT64(x) muma_popcount64_fallback(x)
+			#endif
+			#ifndef MUMA_CTZ64
+				#define MUMA_CTZ64(x) muma_ctz64_fallback(x)
+			#endif
+		#endif
+
+	/* SIMD (internal) */
+
+		// `MUMA_SSE2` is defined if SSE2 intrinsics are available and
+		// `MUMA_NO_SIMD` isn't defined, in which case some functions
+		// use them instead of scalar loops.
+
+		#if !defined(MUMA_NO_SIMD) && !defined(MUMA_SSE2)
+			#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				#define MUMA_SSE2
+			#endif
+		#endif
+
+		#ifdef MUMA_SSE2
+			#include <emmintrin.h>
+		#endif
+
 	// @DOCLINE # Enums
 
 		// @DOCLINE ## Result enum
@@ -477,9 +662,242 @@ Note that mu libraries store their dependencies within their files, so you don't
 				// @DOCLINE `@NLFT`: the array shifting necessary to perform the function was invalid.
 				MUMA_INVALID_SHIFT_AMOUNT,
 				// @DOCLINE `@NLFT`: a requested element in an array could not be located.
-				MUMA_NOT_FOUND
+				MUMA_NOT_FOUND,
+				// @DOCLINE `@NLFT`: the memory necessary to perform the function would have exceeded the hard limit of a memory budget, so it was not allocated.
+				MUMA_BUDGET_EXCEEDED,
+				// @DOCLINE `@NLFT`: a handle that doesn't refer to a valid element was given.
+				MUMA_INVALID_HANDLE,
+				// @DOCLINE `@NLFT`: a read or write on a file descriptor failed (or isn't supported on this platform).
+				MUMA_IO_FAILED,
+				// @DOCLINE `@NLFT`: a thread could not be created (or threads are turned off).
+				MUMA_THREAD_FAILED
 			)
 
+	// @DOCLINE # Memory budgets
+
+		/* @DOCBEGIN
+
+		All memory that muma allocates (including the memory of every dynamic array) is counted against a memory budget, which is a byte count with an optional soft and hard limit. By default, the only budget is the global budget, which has no limits, meaning that nothing is ever refused. Memory is counted against the budget of the calling thread's allocator (see `muma_set_allocator`), which is the global budget unless the allocator's `budget` member says otherwise.
+
+		If an allocation would make a budget's usage exceed its hard limit, the allocation isn't performed, and the function that tried to allocate returns `MUMA_BUDGET_EXCEEDED`. When usage crosses a budget's soft limit, or right before an allocation is refused for going over the hard limit, the budget's callback is called, which gives the user a chance to free memory (for example, trimming caches). If the callback frees enough memory, the refused allocation is retried once and can still succeed.
+
+		Budgets can be chained through a parent budget; acquiring memory from a budget acquires it from all of its parents as well, and fails if any of them would be exceeded. This allows, for example, a budget per tenant whose parent is the global budget, set as the budget of every tenant thread's allocator:
+
+		```c
+		mumaBudget tenant = muma_budget_create(0, 64*1024*1024, 0, 0, muma_global_budget());
+
+		mumaAllocator allocator = muma_get_allocator();
+		allocator.budget = &tenant;
+		muma_set_allocator(&allocator);
+
+		// Every array created and grown on this thread now fails with
+		// MUMA_BUDGET_EXCEEDED once the tenant has 64 MiB of memory.
+		```
+
+		Note that a budget only counts the bytes requested from it, not the overhead of the underlying allocator.
+
+		@DOCEND */
+
+		typedef struct mumaBudget mumaBudget;
+
+		// @DOCLINE ## Callback
+
+			// @DOCLINE The type `mumaBudgetCallback` is the type of a budget's callback, defined below: @NLNT
+			typedef void (*mumaBudgetCallback)(mumaBudget* budget, size_m usage, size_m request, void* user_data);
+
+			// @DOCLINE `usage` is the budget's current usage in bytes, and `request` is the size in bytes of the allocation that caused the callback to be called. Note that this callback can be called from any thread that allocates through muma.
+
+		// @DOCLINE ## Struct
+
+			// @DOCLINE The struct `mumaBudget` represents a memory budget. It has the following members:
+
+			struct mumaBudget {
+				// @DOCLINE `@NLFT`: the amount of bytes currently acquired from the budget.
+				size_m usage;
+				// @DOCLINE `@NLFT`: the usage at which the callback is called, with 0 meaning no soft limit.
+				size_m soft_limit;
+				// @DOCLINE `@NLFT`: the usage that cannot be exceeded, with 0 meaning no hard limit.
+				size_m hard_limit;
+				// @DOCLINE `@NLFT`: the callback called when under memory pressure (can be 0).
+				mumaBudgetCallback callback;
+				// @DOCLINE `@NLFT`: the pointer passed to `callback`.
+				void* user_data;
+				// @DOCLINE `@NLFT`: the budget that also gets acquired from whenever this budget is (0 only for the global budget).
+				mumaBudget* parent;
+			};
+
+			// @DOCLINE Note that `usage` is updated atomically, and shouldn't be modified by the user.
+
+	// @DOCLINE # Allocators
+
+		/* @DOCBEGIN
+
+		By default, muma allocates memory with `mu_malloc`, `mu_realloc`, and `mu_free`. Instead, a thread can set its own allocator with `muma_set_allocator`, after which every allocation that muma makes on that thread (including the memory of every dynamic array and other container) goes through that allocator.
+
+		muma also provides two allocators that manage a region of memory given by the user, a TLSF allocator and a buddy allocator, as well as a thread-caching allocator, all of which can be used for this.
+
+		@DOCEND */
+
+		// @DOCLINE ## Allocator struct
+
+			// @DOCLINE The struct `mumaAllocator` represents an allocator. It has the following members:
+
+			struct mumaAllocator {
+				// @DOCLINE `@NLFT`: allocates `size` bytes, returning 0 on failure.
+				void* (*allocate)(void* user_data, size_m size);
+				// @DOCLINE `@NLFT`: reallocates `p` from `old_size` to `new_size` bytes, returning 0 (and leaving `p` untouched) on failure.
+				void* (*reallocate)(void* user_data, void* p, size_m old_size, size_m new_size);
+				// @DOCLINE `@NLFT`: frees `p`, which is `size` bytes large.
+				void (*deallocate)(void* user_data, void* p, size_m size);
+				// @DOCLINE `@NLFT`: the pointer passed to each function.
+				void* user_data;
+				// @DOCLINE `@NLFT`: the memory budget that memory allocated through this allocator is counted against (0 for the global budget).
+				mumaBudget* budget;
+			}; typedef struct mumaAllocator mumaAllocator;
+
+			// @DOCLINE Memory returned by an allocator must be aligned for any type, like memory returned by `malloc`. The functions can be left as 0 to use `mu_malloc`, `mu_realloc`, and `mu_free`, which allows, for example, giving a thread its own budget without changing how it allocates.
+
+		// @DOCLINE ## TLSF allocator
+
+			/* @DOCBEGIN
+
+			The struct `mumaTLSF` is a Two-Level Segregated Fit allocator, which manages a single region of memory provided by the user. Allocating, freeing, and growing or shrinking a block in place all take O(1) time in the worst case, and the allocator never calls into the operating system or takes a lock, which makes it suitable for real-time threads.
+
+			Free blocks are kept in segregated lists indexed by a first level (the power of 2 of the block's size) and a second level (one of 32 linear subdivisions of that power of 2), with a bitmap per level, so a large enough free block is found with two bit scans. Adjacent free blocks are merged as soon as they are freed.
+
+			Blocks are aligned to 16 bytes and have 16 bytes of overhead (on 64-bit systems), and a single block can be at most a little under 4 GiB large. The bookkeeping of the allocator is stored at the start of its region.
+
+			Note that a TLSF allocator is not thread-safe; it should be owned by a single thread, or be protected by a lock by the user.
+
+			@DOCEND */
+
+			// Amount of second-level lists per first level (log2)
+			#define MUMA_TLSF_SL_LOG2 5
+			#define MUMA_TLSF_SL_COUNT (1 << MUMA_TLSF_SL_LOG2)
+			// Alignment of every block (log2)
+			#define MUMA_TLSF_ALIGN_LOG2 4
+			#define MUMA_TLSF_ALIGN (1 << MUMA_TLSF_ALIGN_LOG2)
+			// Sizes below this all fall in the first first-level list
+			#define MUMA_TLSF_FL_SHIFT (MUMA_TLSF_SL_LOG2 + MUMA_TLSF_ALIGN_LOG2)
+			// Blocks are smaller than 2^MUMA_TLSF_FL_MAX bytes
+			#define MUMA_TLSF_FL_MAX 32
+			#define MUMA_TLSF_FL_COUNT (MUMA_TLSF_FL_MAX - MUMA_TLSF_FL_SHIFT + 1)
+
+			typedef struct mumaTLSFBlock mumaTLSFBlock;
+
+			// @DOCLINE The struct `mumaTLSF` has the following members that are meant to be read by the user:
+
+			struct mumaTLSF {
+				// @DOCLINE `@NLFT`: the amount of bytes available for blocks in the allocator's region.
+				size_m size;
+				// @DOCLINE `@NLFT`: the amount of bytes currently allocated, including rounding and block overhead.
+				size_m usage;
+				// @DOCLINE `@NLFT`: the highest that `usage` has been.
+				size_m peak_usage;
+
+				uint32_m fl_bitmap;
+				uint32_m sl_bitmap[MUMA_TLSF_FL_COUNT];
+				mumaTLSFBlock* blocks[MUMA_TLSF_FL_COUNT][MUMA_TLSF_SL_COUNT];
+			}; typedef struct mumaTLSF mumaTLSF;
+
+		// @DOCLINE ## Buddy allocator
+
+			/* @DOCBEGIN
+
+			The struct `mumaBuddy` is a buddy allocator, which manages a single region of memory provided by the user. Every block is a power of 2 times the allocator's minimum block size, and is aligned to its own size relative to the start of the region. A free block can be merged with its "buddy" (the other half of the block twice its size) if that buddy is free as well, which happens as soon as a block is freed.
+
+			This suits dynamic arrays well, since their capacity always changes by factors of 2: growing a block first tries to merge it with its free buddies in place (without copying anything), and shrinking a block splits it in place, giving the rest back to the allocator.
+
+			Allocations have no header; the size of every block is instead kept in a table with a byte per minimum-sized block, which is stored at the start of the region along with the rest of the allocator's bookkeeping.
+
+			Note that a buddy allocator is not thread-safe; it should be owned by a single thread, or be protected by a lock by the user.
+
+			@DOCEND */
+
+			// Amount of block sizes (so the largest block is the minimum
+			// block size times 2^(MUMA_BUDDY_ORDER_COUNT-1))
+			#define MUMA_BUDDY_ORDER_COUNT 48
+
+			typedef struct mumaBuddyBlock mumaBuddyBlock;
+
+			// @DOCLINE The struct `mumaBuddy` has the following members that are meant to be read by the user:
+
+			struct mumaBuddy {
+				// @DOCLINE `@NLFT`: the amount of bytes available for blocks in the allocator's region.
+				size_m size;
+				// @DOCLINE `@NLFT`: the size of the smallest block.
+				size_m min_block;
+
+				size_m min_log2;
+				size_m max_order;
+				muByte* base;
+				muByte* orders;
+				uint64_m free_bitmap;
+				mumaBuddyBlock* free_lists[MUMA_BUDDY_ORDER_COUNT];
+
+				size_m requested;
+				size_m allocated;
+				size_m free_blocks;
+				size_m in_place_reallocs;
+				size_m moved_reallocs;
+			}; typedef struct mumaBuddy mumaBuddy;
+
+			// @DOCLINE ### Statistics
+
+			// @DOCLINE The struct `mumaBuddyStats` holds statistics about a buddy allocator, and has the following members:
+
+			struct mumaBuddyStats {
+				// @DOCLINE `@NLFT`: the amount of bytes available for blocks in the allocator's region.
+				size_m size;
+				// @DOCLINE `@NLFT`: the amount of bytes requested by every live allocation.
+				size_m requested;
+				// @DOCLINE `@NLFT`: the amount of bytes in allocated blocks.
+				size_m allocated;
+				// @DOCLINE `@NLFT`: the amount of bytes in free blocks.
+				size_m free;
+				// @DOCLINE `@NLFT`: the amount of free blocks.
+				size_m free_blocks;
+				// @DOCLINE `@NLFT`: the size of the largest free block, which is the largest allocation that can currently succeed.
+				size_m largest_free_block;
+				// @DOCLINE `@NLFT`: the amount of reallocations that grew or shrank a block in place.
+				size_m in_place_reallocs;
+				// @DOCLINE `@NLFT`: the amount of reallocations that had to move a block (copying its contents).
+				size_m moved_reallocs;
+				// @DOCLINE `@NLFT`: the internal fragmentation, which is the fraction of allocated bytes that weren't requested (`1 - requested / allocated`).
+				double internal_fragmentation;
+				// @DOCLINE `@NLFT`: the external fragmentation, which is the fraction of free bytes that aren't part of the largest free block (`1 - largest_free_block / free`).
+				double external_fragmentation;
+			}; typedef struct mumaBuddyStats mumaBuddyStats;
+
+		// @DOCLINE ## Caching allocator
+
+			/* @DOCBEGIN
+
+			The struct `mumaCachingAllocator` is a thread-caching allocator meant for many threads allocating at once. Allocations of up to `MUMA_CACHING_MAX_SIZE` bytes are rounded up to a power of 2 (a size class), which matches the capacities of dynamic arrays, and larger allocations are passed on to `mu_malloc`, `mu_realloc`, and `mu_free`.
+
+			Every thread has its own cache of free blocks for each size class, which allocations are taken from and frees are given back to without any locking. When a thread's cache of a size class runs out, it is refilled with a batch of blocks from a central pool (which has a lock per size class, and gets its blocks in large chunks from `mu_malloc`), and when it holds too many blocks, a batch of them is given back to the central pool.
+
+			Blocks belong to the allocator, not to a thread, so memory can be freed on a different thread than the one that allocated it; the block just ends up in the freeing thread's cache, and makes its way back to the central pool from there if that thread doesn't need it.
+
+			A thread can hold caches for up to `MUMA_CACHING_THREAD_SLOTS` caching allocators at once; if it uses more than that, the oldest of its caches is abandoned (its blocks only get reused once the allocator is destroyed), so that cache should be flushed with `muma_caching_flush` beforehand. Similarly, a thread should call `muma_caching_flush` before exiting, or the blocks in its cache stay unused until the allocator is destroyed.
+
+			Note that the memory of a caching allocator (including the memory that is cached) is only freed when it is destroyed.
+
+			@DOCEND */
+
+			// Smallest size class (log2)
+			#define MUMA_CACHING_MIN_LOG2 4
+			// Largest size class (log2); anything larger isn't cached
+			#define MUMA_CACHING_MAX_LOG2 16
+			#define MUMA_CACHING_MAX_SIZE ((size_m)1 << MUMA_CACHING_MAX_LOG2)
+			#define MUMA_CACHING_CLASS_COUNT (MUMA_CACHING_MAX_LOG2 - MUMA_CACHING_MIN_LOG2 + 1)
+			// Amount of caching allocators a thread can have caches for
+			#define MUMA_CACHING_THREAD_SLOTS 8
+
+			typedef struct mumaCachingAllocator mumaCachingAllocator;
+
+			// @DOCLINE The struct `mumaCachingAllocator` is opaque, and is created with `muma_caching_create`.
+
 	// @DOCLINE # Macros
 
 		// @DOCLINE ## Dynamic array
@@ -516,19 +934,109 @@ Note that mu libraries store their dependencies within their files, so you don't
 
 			Note that these members aren't meant to be modified by the user, only read.
 
+			Note that all memory used by a dynamic array is allocated through `muma_malloc`, `muma_realloc`, and `muma_free`, so it is counted against the budget of the allocator that was set when it was (re)allocated.
+
+			### Ranges
+
+			Some functions take in a list of ranges of elements, represented by the struct `mumaRange`, which is defined as so:
+
+			```c
+			struct mumaRange {
+				size_m index;
+				size_m count;
+			}; typedef struct mumaRange mumaRange;
+			```
+
+			`index` is the index of the first element in the range, and `count` is the amount of elements in the range.
+
+			### Linkage
+
+			`mu_dynamic_array_declaration` defines its functions with external linkage, meaning that it can only be expanded in one translation unit. For dynamic arrays used across several files, the declaration can be split into two macros with the same parameters:
+
+			```c
+			mu_dynamic_array_header(struct_name, type, function_name_prefix, type_comparison_func)
+			mu_dynamic_array_impl(struct_name, type, function_name_prefix, type_comparison_func)
+			```
+
+			`mu_dynamic_array_header` defines the struct and declares the functions, and can be expanded in a header file; `mu_dynamic_array_impl` defines the functions, and must be expanded in exactly one translation unit that has already expanded `mu_dynamic_array_header`.
+
+			Alternatively, the functions can be defined as `static inline` in every translation unit that uses them, allowing the compiler to inline them at every call site (without needing link-time optimization), using the following macro with the same parameters:
+
+			```c
+			mu_dynamic_array_static_declaration(struct_name, type, function_name_prefix, type_comparison_func)
+			```
+
+			Note that, once inlined, calls that pass 0 for `result` compile down to no result checks at all.
+
+			All of these macros are built on the following macros, which can also be used directly to define a variant with a different linkage and a different growth policy:
+
+			```c
+			mu_dynamic_array_struct(struct_name, type)
+			mu_dynamic_array_prototypes(struct_name, type, function_name_prefix, linkage)
+			mu_dynamic_array_definitions(struct_name, type, function_name_prefix, type_comparison_func, linkage, capacity_func)
+			```
+
+			`linkage` is placed before every function (for example, nothing, `static`, or `static MUMA_INLINE`), and `capacity_func` is the name of a function or macro function that takes in the current allocated length and the new length of an array (both `size_m`) and returns the allocated length that the array should have, which must be at least the new length. The default, `muma_dynamic_array_capacity`, doubles the allocated length until the array fits and halves it while the array takes up less than half of it. Since `capacity_func` is resolved at compile time, a fixed policy (such as always allocating exactly the new length) costs no runtime branches.
+
 			### Functions
 
 			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
 
 			@DOCEND */
 
-			#define mu_dynamic_array_declaration(struct_name, type, function_name_prefix, type_comparison_func) \
+			struct mumaRange {
+				size_m index;
+				size_m count;
+			}; typedef struct mumaRange mumaRange;
+
+			// Default growth policy of a dynamic array
+			static MUMA_INLINE size_m muma_dynamic_array_capacity(size_m allocated_length, size_m length) {
+				while (length > allocated_length) {
+					allocated_length *= 2;
+				}
+				while (length < allocated_length/2) {
+					allocated_length /= 2;
+				}
+				return allocated_length;
+			}
+
+			#define mu_dynamic_array_struct(struct_name, type) \
 				\
 				struct struct_name { \
 					type* data; \
 					size_m allocated_length; \
 					size_m length; \
-				}; typedef struct struct_name struct_name; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_dynamic_array_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length); \
+				linkage struct_name function_name_prefix##lshift(mumaResult* result, struct_name s, size_m index, size_m amount); \
+				linkage struct_name function_name_prefix##rshift(mumaResult* result, struct_name s, size_m index, size_m amount); \
+				linkage struct_name function_name_prefix##multiinsert(mumaResult* result, struct_name s, size_m index, type* insert, size_m count); \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert); \
+				linkage struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count); \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index); \
+				linkage struct_name function_name_prefix##batch_insert(mumaResult* result, struct_name s, size_m* positions, type* insert, size_m count); \
+				linkage struct_name function_name_prefix##batch_erase(mumaResult* result, struct_name s, mumaRange* ranges, size_m count); \
+				linkage struct_name function_name_prefix##splice(mumaResult* result, struct_name s, size_m index, struct_name* src); \
+				linkage struct_name function_name_prefix##append_move(mumaResult* result, struct_name s, struct_name* src); \
+				linkage struct_name function_name_prefix##concat(mumaResult* result, struct_name a, struct_name b); \
+				linkage struct_name function_name_prefix##push_uninit(mumaResult* result, struct_name s, size_m count, type** p_data); \
+				linkage struct_name function_name_prefix##commit(mumaResult* result, struct_name s, size_m count); \
+				linkage struct_name function_name_prefix##read(mumaResult* result, struct_name s, int fd, size_m count, size_m* p_count); \
+				linkage size_m function_name_prefix##write(mumaResult* result, struct_name s, int fd, size_m index, size_m count); \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##multipush(mumaResult* result, struct_name s, type* push, size_m count); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type push); \
+				linkage struct_name function_name_prefix##multipop(mumaResult* result, struct_name s, size_m count); \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s); \
+				linkage size_m function_name_prefix##find(mumaResult* result, struct_name s, type find); \
+				linkage struct_name function_name_prefix##find_push(mumaResult* result, struct_name s, type find, size_m* p_index);
+
+			#define mu_dynamic_array_definitions(struct_name, type, function_name_prefix, type_comparison_func, linkage, capacity_func) \
 				\
 				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
 				/*@DOCBEGIN The function `function_name_prefix##create` is used to create a dynamic array, defined below: @NEWLINE @DOCEND*/ \
@@ -536,7 +1044,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m length) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that `length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					struct_name s = MU_ZERO_STRUCT(struct_name); \
@@ -548,9 +1056,10 @@ Note that mu libraries store their dependencies within their files, so you don't
 						return s; \
 					} \
 					\
-					s.data = (type*)mu_malloc(sizeof(type)*s.allocated_length); \
+					mumaResult res = MUMA_SUCCESS; \
+					s.data = (type*)muma_malloc(&res, sizeof(type)*s.allocated_length); \
 					if (s.data == 0) { \
-						MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE) \
+						MU_SET_RESULT(result, res) \
 						s.allocated_length = 0; \
 						s.length = 0; \
 						return s; \
@@ -566,11 +1075,11 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that this function is safe to call on an array with nothing allocated (of course, assuming that its members are valid). @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					if (s.data != MU_NULL_PTR) { \
-						mu_free(s.data); \
+						muma_free(s.data, sizeof(type)*s.allocated_length); \
 						s.data = MU_NULL_PTR; \
 					} \
 					\
@@ -587,7 +1096,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `length`. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that `length` is allowed to be any value, including being above, below, or equal to the array's length / allocated length, as well as 0 (although, it cannot be guaranteed that this will free memory). @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that, in general, this function is not guaranteed to allocate or free any memory, even if the length is changing a significant amount. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) { \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					if (s.length == length) { \
@@ -617,19 +1126,14 @@ Note that mu libraries store their dependencies within their files, so you don't
 					size_m old_allocated_length = s.allocated_length; \
 					s.length = length; \
 					\
-					if ((s.length > s.allocated_length) || (s.length < s.allocated_length/2)) { \
-						while (s.length > s.allocated_length) { \
-							s.allocated_length *= 2; \
-						} \
-						while (s.length < s.allocated_length/2) { \
-							s.allocated_length /= 2; \
-						} \
-						\
-						type* new_data = (type*)mu_realloc(s.data, sizeof(type) * s.allocated_length); \
+					s.allocated_length = capacity_func(old_allocated_length, s.length); \
+					if (s.allocated_length != old_allocated_length) { \
+						mumaResult res = MUMA_SUCCESS; \
+						type* new_data = (type*)muma_realloc(&res, s.data, sizeof(type) * old_allocated_length, sizeof(type) * s.allocated_length); \
 						if (new_data == 0) { \
 							s.length = old_length; \
 							s.allocated_length = old_allocated_length; \
-							MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE) \
+							MU_SET_RESULT(result, res) \
 							return s; \
 						} \
 						\
@@ -651,7 +1155,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN This function takes all of the elements of an array starting from `index` and ending at the end of the array, and shifts them left `amount` amount of times. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `s.length` minus `amount`. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that this operation can overwrite contents of other elements within the array. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##lshift(mumaResult* result, struct_name s, size_m index, size_m amount) { \
+				linkage struct_name function_name_prefix##lshift(mumaResult* result, struct_name s, size_m index, size_m amount) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					if (index >= s.length) { \
@@ -688,7 +1192,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN This function takes all of the elements of an array starting from `index` and ending at the end of the array, and shifts them right `amount` amount of times. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `s.length` plus `amount`. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN Note that this operation cannot overwrite contents of other elements within the array. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##rshift(mumaResult* result, struct_name s, size_m index, size_m amount) { \
+				linkage struct_name function_name_prefix##rshift(mumaResult* result, struct_name s, size_m index, size_m amount) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					if (index >= s.length) { \
@@ -707,9 +1211,8 @@ Note that mu libraries store their dependencies within their files, so you don't
 						return s; \
 					} \
 					\
-					/* I have genuinely no idea why it needs to have a -1. It crashes if you don't. */\
-					/* And lshift doesn't need one. Why?? */ \
-					mu_memmove(&s.data[index+amount], &s.data[index], sizeof(type)*((s.length-index)-1)); \
+					/* s.length already includes amount, so (s.length-amount)-index elements move. */ \
+					mu_memmove(&s.data[index+amount], &s.data[index], sizeof(type)*((s.length-amount)-index)); \
 					mu_memset(&s.data[index], 0, sizeof(type)*(amount)); \
 					\
 					return s; \
@@ -722,7 +1225,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN This function takes `insert` (which should have `count` amount of `type` elements) and inserts it at index `index`. @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `s.length` plus `count`, and `s.data[index+n]` will be equal to `insert[0+n]` while `n` is less than `count` (ie, `s.data[index+0] == insert[0]`). @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##multiinsert(mumaResult* result, struct_name s, size_m index, type* insert, size_m count) { \
+				linkage struct_name function_name_prefix##multiinsert(mumaResult* result, struct_name s, size_m index, type* insert, size_m count) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
 					mumaResult res = MUMA_SUCCESS; \
@@ -745,7 +1248,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN function_name_prefix##multiinsert(result, s, index, &insert, 1) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert) { \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert) { \
 					return function_name_prefix##multiinsert(result, s, index, &insert, 1); \
 				} \
 				\
@@ -758,7 +1261,7 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN function_name_prefix##lshift(result, s, index+count, count) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count) { \
+				linkage struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count) { \
 					return function_name_prefix##lshift(result, s, index+count, count); \
 				} \
 				\
@@ -771,23 +1274,31 @@ Note that mu libraries store their dependencies within their files, so you don't
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN function_name_prefix##multierase(result, s, index, 1) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) { \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) { \
 					return function_name_prefix##multierase(result, s, index, 1); \
 				} \
-				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##clear` is used to clear all the elements from an array. It is identical to `function_name_prefix##destroy`. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##clear(mumaResult* result, struct_name s) { \
-					return function_name_prefix##destroy(result, s); \
-				} \
 				\
-				/*@DOCBEGIN #### Multi-push @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##multipush` is used to push multiple elements on top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Batch insert @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##batch_insert` is used to insert elements at several positions of an array at once, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN struct_name function_name_prefix##multipush(mumaResult* result, struct_name s, type* push, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##batch_insert(mumaResult* result, struct_name s, size_m* positions, type* insert, size_m count) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##multipush(mumaResult* result, struct_name s, type* push, size_m count) { \
+				/*@DOCBEGIN This function inserts `insert[n]` right before the element that was at index `positions[n]` before the call (with `s.length` meaning the end of the array), for every `n` less than `count`. `positions` must be sorted in ascending order; elements inserted at the same position keep the order that they were given in. If `positions` isn't sorted or refers past the end of the array, nothing is modified and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Unlike calling `function_name_prefix##insert` `count` times, the array is resized only once, and every existing element is moved at most once, going from O(count*length) to O(count+length). @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##batch_insert(mumaResult* result, struct_name s, size_m* positions, type* insert, size_m count) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
+					for (size_m i = 0; i < count; i++) { \
+						if (positions[i] > s.length || (i != 0 && positions[i] < positions[i-1])) { \
+							MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+							return s; \
+						} \
+					} \
+					if (count == 0) { \
+						return s; \
+					} \
+					\
+					size_m old_length = s.length; \
 					mumaResult res = MUMA_SUCCESS; \
 					s = function_name_prefix##resize(&res, s, s.length+count); \
 					if (res != MUMA_SUCCESS) { \
@@ -795,76 +1306,331 @@ Note that mu libraries store their dependencies within their files, so you don't
 						return s; \
 					} \
 					\
-					mu_memcpy(&s.data[s.length-count], push, sizeof(type)*count); \
+					/* Going from the back, every element between positions[n-1] */ \
+					/* and positions[n] moves right by exactly n. */ \
+					size_m end = old_length; \
+					for (size_m n = count; n > 0; n--) { \
+						size_m position = positions[n-1]; \
+						mu_memmove(&s.data[position+n], &s.data[position], sizeof(type)*(end-position)); \
+						s.data[position+n-1] = insert[n-1]; \
+						end = position; \
+					} \
 					return s; \
 				} \
 				\
-				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element on top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Batch erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##batch_erase` is used to erase several ranges of elements from an array at once, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, type push) @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN This function just returns `function_name_prefix##multipush` with the following parameters: @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN function_name_prefix##multipush(result, s, &push, 1) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##batch_erase(mumaResult* result, struct_name s, mumaRange* ranges, size_m count) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##push(mumaResult* result, struct_name s, type push) { \
-					return function_name_prefix##multipush(result, s, &push, 1); \
+				/*@DOCBEGIN This function erases the `count` ranges in `ranges`, which refer to indexes from before the call. `ranges` must be sorted in ascending order and can't overlap; if they do, or if a range goes past the end of the array, nothing is modified and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Unlike calling `function_name_prefix##multierase` `count` times, every remaining element is moved at most once and the array is resized only once. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##batch_erase(mumaResult* result, struct_name s, mumaRange* ranges, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m previous_end = 0; \
+					for (size_m i = 0; i < count; i++) { \
+						if (ranges[i].index < previous_end || ranges[i].index > s.length || ranges[i].count > s.length-ranges[i].index) { \
+							MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+							return s; \
+						} \
+						previous_end = ranges[i].index + ranges[i].count; \
+					} \
+					if (count == 0) { \
+						return s; \
+					} \
+					\
+					/* Compact the kept spans between ranges toward the front */ \
+					size_m write = ranges[0].index; \
+					for (size_m i = 0; i < count; i++) { \
+						size_m begin = ranges[i].index + ranges[i].count; \
+						size_m end = (i+1 < count) ? ranges[i+1].index : s.length; \
+						if (write != begin) { \
+							mu_memmove(&s.data[write], &s.data[begin], sizeof(type)*(end-begin)); \
+						} \
+						write += end-begin; \
+					} \
+					\
+					return function_name_prefix##resize(result, s, write); \
 				} \
 				\
-				/*@DOCBEGIN #### Multi-pop @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##multipop` is used to pop multiple elements from the top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Splice @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##splice` is used to move all of the elements of one array into another at a given index, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN struct_name function_name_prefix##multipop(mumaResult* result, struct_name s, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##splice(mumaResult* result, struct_name s, size_m index, struct_name* src) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##multipop(mumaResult* result, struct_name s, size_m count) { \
-					return function_name_prefix##resize(result, s, s.length-count); \
+				/*@DOCBEGIN This function inserts the elements of `*src` into `s` right before the element at index `index` (`s.length` meaning the end of the array), and, if successful, leaves `*src` as an empty array with nothing allocated, meaning that it doesn't need to be destroyed afterwards. If this function fails, neither array is modified. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Rather than always copying `*src` into `s`, the resulting array is built in whichever allocation needs the least work: if `s` is empty, the allocation of `*src` is taken over with no copying at all; if `s` doesn't have room for the result but `*src` does, the result is built in the allocation of `*src` instead; otherwise, `s` is grown (without zeroing its new elements) and `*src` is copied into it. The allocation that isn't kept is freed. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##splice(mumaResult* result, struct_name s, size_m index, struct_name* src) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index > s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					size_m length = s.length + src->length; \
+					if (src->length == 0) { \
+						*src = function_name_prefix##destroy(&res, *src); \
+						return s; \
+					} \
+					\
+					if (s.length == 0 || (s.allocated_length < length && src->allocated_length >= length)) { \
+						struct_name d = *src; \
+						if (s.length != 0) { \
+							mu_memmove(&d.data[index], d.data, sizeof(type)*d.length); \
+							mu_memcpy(d.data, s.data, sizeof(type)*index); \
+							mu_memcpy(&d.data[index+d.length], &s.data[index], sizeof(type)*(s.length-index)); \
+						} \
+						d.length = length; \
+						\
+						s = function_name_prefix##destroy(&res, s); \
+						*src = MU_ZERO_STRUCT(struct_name); \
+						src->data = MU_NULL_PTR; \
+						return d; \
+					} \
+					\
+					if (s.allocated_length < length) { \
+						size_m allocated_length = capacity_func(s.allocated_length, length); \
+						type* new_data = (type*)muma_realloc(&res, s.data, sizeof(type)*s.allocated_length, sizeof(type)*allocated_length); \
+						if (new_data == 0) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						s.data = new_data; \
+						s.allocated_length = allocated_length; \
+					} \
+					\
+					mu_memmove(&s.data[index+src->length], &s.data[index], sizeof(type)*(s.length-index)); \
+					mu_memcpy(&s.data[index], src->data, sizeof(type)*src->length); \
+					s.length = length; \
+					\
+					*src = function_name_prefix##destroy(&res, *src); \
+					return s; \
 				} \
 				\
-				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop an element from the top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Append-move @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##append_move` is used to move all of the elements of one array onto the end of another, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN struct_name function_name_prefix##pop(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##append_move(mumaResult* result, struct_name s, struct_name* src) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN This function just returns `function_name_prefix##multipop` with the following parameters: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function just returns `function_name_prefix##splice` with the following parameters: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN function_name_prefix##multipop(result, s, 1) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN function_name_prefix##splice(result, s, s.length, src) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##pop(mumaResult* result, struct_name s) { \
-					return function_name_prefix##multipop(result, s, 1); \
+				linkage struct_name function_name_prefix##append_move(mumaResult* result, struct_name s, struct_name* src) { \
+					return function_name_prefix##splice(result, s, s.length, src); \
 				} \
 				\
-				/*@DOCBEGIN #### Find @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##find` is used to find a certain element in an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Concatenate @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##concat` is used to combine two arrays into one, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN size_m function_name_prefix##find(mumaResult* result, struct_name s, type find) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##concat(mumaResult* result, struct_name a, struct_name b) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN This function scans from index 0 up until the end of the array and uses `type_comparison_func` to decide if `find` equals the element at the given index. @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN If a matching element is found, its index is returned. @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN If no matching element is found, `MU_SIZE_MAX` is returned. @NEWLINE @DOCEND */ \
-				size_m function_name_prefix##find(mumaResult* result, struct_name s, type find) { \
-					MU_SET_RESULT(result, MUMA_SUCCESS) \
-					\
-					for (size_m i = 0; i < s.length; i++) { \
-						if (type_comparison_func(find, s.data[i])) { \
-							return i; \
-						} \
-					} \
-					\
-					MU_SET_RESULT(result, MUMA_NOT_FOUND) \
-					return MU_SIZE_MAX; \
+				/*@DOCBEGIN This function returns an array holding the elements of `a` followed by the elements of `b`, reusing the allocation of either one like `function_name_prefix##splice` does. If successful, `a` and `b` are consumed, and only the returned array needs to be destroyed; if not, `a` is returned and neither array is modified. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##concat(mumaResult* result, struct_name a, struct_name b) { \
+					return function_name_prefix##splice(result, a, a.length, &b); \
 				} \
 				\
-				/*@DOCBEGIN #### Find-push @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN The function `function_name_prefix##find_push` is used to find a certain element in an array and, if not found, push it onto the array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN #### Push uninitialized @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push_uninit` is used to get room for elements at the end of an array that can be written to directly, defined below: @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN struct_name function_name_prefix##find_push(mumaResult* result, struct_name s, type find, size_m* p_index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push_uninit(mumaResult* result, struct_name s, size_m count, type** p_data) @NEWLINE @DOCEND */ \
 				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
-				/*@DOCBEGIN This function tries to find `find` in the given array `s` using `function_name_prefix##find` and, if not found, pushes `find` onto the array. In either case, if successful and `p_index` isn't 0, `p_index` is dereferenced and set to the index that contains `find`. @NEWLINE @DOCEND */ \
-				struct_name function_name_prefix##find_push(mumaResult* result, struct_name s, type find, size_m* p_index) { \
+				/*@DOCBEGIN This function makes sure that the array has room for at least `count` elements past `s.length` (growing it like `function_name_prefix##resize` would, but without zeroing anything), and, if successful and `p_data` isn't 0, dereferences `p_data` and sets it to `&s.data[s.length]`. `s.length` is not changed; once some amount of the elements have been written (for example, by reading from a file or socket directly into them), `function_name_prefix##commit` is used to add them to the array. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that the pointer is invalidated by any function that can reallocate the array, so it must be written to and committed before any of them are called. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push_uninit(mumaResult* result, struct_name s, size_m count, type** p_data) { \
 					MU_SET_RESULT(result, MUMA_SUCCESS) \
 					\
-					mumaResult res = MUMA_SUCCESS; \
+					size_m length = s.length + count; \
+					if (length > s.allocated_length) { \
+						size_m allocated_length = (s.allocated_length == 0) ? length : capacity_func(s.allocated_length, length); \
+						mumaResult res = MUMA_SUCCESS; \
+						type* new_data = (type*)muma_realloc(&res, s.data, sizeof(type)*s.allocated_length, sizeof(type)*allocated_length); \
+						if (new_data == 0) { \
+							if (p_data != MU_NULL_PTR) { \
+								*p_data = MU_NULL_PTR; \
+							} \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						s.data = new_data; \
+						s.allocated_length = allocated_length; \
+					} \
+					\
+					if (p_data != MU_NULL_PTR) { \
+						*p_data = (s.data == MU_NULL_PTR) ? MU_NULL_PTR : &s.data[s.length]; \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Commit @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##commit` is used to add elements written past the end of an array to it, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##commit(mumaResult* result, struct_name s, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function adds `count` to `s.length`, and is meant to be called after writing to room given by `function_name_prefix##push_uninit`; `count` can be less than the amount of room asked for. If `count` goes past `s.allocated_length`, nothing is modified and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##commit(mumaResult* result, struct_name s, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (count > s.allocated_length-s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					s.length += count; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Read @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##read` is used to read elements from a file descriptor directly onto the end of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##read(mumaResult* result, struct_name s, int fd, size_m count, size_m* p_count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function gets room for `count` elements with `function_name_prefix##push_uninit`, reads up to `count` elements into it with `muma_read`, and commits however many elements were read, which, if `p_count` isn't 0, `p_count` is dereferenced and set to (0 meaning end-of-file). The raw bytes are read with no intermediate buffer. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that, for types larger than one byte, reading continues until a whole amount of elements has been read; the bytes of an incomplete element at end-of-file or on error are discarded. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##read(mumaResult* result, struct_name s, int fd, size_m count, size_m* p_count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (p_count != MU_NULL_PTR) { \
+						*p_count = 0; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					type* data; \
+					s = function_name_prefix##push_uninit(&res, s, count, &data); \
+					if (res != MUMA_SUCCESS || count == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					size_m bytes = muma_read(&res, fd, data, sizeof(type)*count); \
+					while (res == MUMA_SUCCESS && bytes != 0 && bytes%sizeof(type) != 0) { \
+						size_m r = muma_read(&res, fd, ((muByte*)data)+bytes, sizeof(type)-(bytes%sizeof(type))); \
+						if (r == 0) { \
+							break; \
+						} \
+						bytes += r; \
+					} \
+					MU_SET_RESULT(result, res) \
+					\
+					if (p_count != MU_NULL_PTR) { \
+						*p_count = bytes/sizeof(type); \
+					} \
+					return function_name_prefix##commit(MU_NULL_PTR, s, bytes/sizeof(type)); \
+				} \
+				\
+				/*@DOCBEGIN #### Write @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##write` is used to write elements of an array directly to a file descriptor, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##write(mumaResult* result, struct_name s, int fd, size_m index, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function writes the `count` elements starting at index `index` with `muma_write`, and returns the amount of whole elements written, which is only less than `count` if the function fails. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##write(mumaResult* result, struct_name s, int fd, size_m index, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index > s.length || count > s.length-index) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return 0; \
+					} \
+					if (count == 0) { \
+						return 0; \
+					} \
+					\
+					return muma_write(result, fd, &s.data[index], sizeof(type)*count) / sizeof(type); \
+				} \
+				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##clear` is used to clear all the elements from an array. It is identical to `function_name_prefix##destroy`. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s) { \
+					return function_name_prefix##destroy(result, s); \
+				} \
+				\
+				/*@DOCBEGIN #### Multi-push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##multipush` is used to push multiple elements on top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##multipush(mumaResult* result, struct_name s, type* push, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##multipush(mumaResult* result, struct_name s, type* push, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##resize(&res, s, s.length+count); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					mu_memcpy(&s.data[s.length-count], push, sizeof(type)*count); \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element on top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, type push) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function just returns `function_name_prefix##multipush` with the following parameters: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN function_name_prefix##multipush(result, s, &push, 1) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type push) { \
+					return function_name_prefix##multipush(result, s, &push, 1); \
+				} \
+				\
+				/*@DOCBEGIN #### Multi-pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##multipop` is used to pop multiple elements from the top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##multipop(mumaResult* result, struct_name s, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##multipop(mumaResult* result, struct_name s, size_m count) { \
+					return function_name_prefix##resize(result, s, s.length-count); \
+				} \
+				\
+				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop an element from the top of an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##pop(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function just returns `function_name_prefix##multipop` with the following parameters: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN function_name_prefix##multipop(result, s, 1) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s) { \
+					return function_name_prefix##multipop(result, s, 1); \
+				} \
+				\
+				/*@DOCBEGIN #### Find @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find` is used to find a certain element in an array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##find(mumaResult* result, struct_name s, type find) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function scans from index 0 up until the end of the array and uses `type_comparison_func` to decide if `find` equals the element at the given index. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If a matching element is found, its index is returned. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If no matching element is found, `MU_SIZE_MAX` is returned. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##find(mumaResult* result, struct_name s, type find) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					for (size_m i = 0; i < s.length; i++) { \
+						if (type_comparison_func(find, s.data[i])) { \
+							return i; \
+						} \
+					} \
+					\
+					MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+					return MU_SIZE_MAX; \
+				} \
+				\
+				/*@DOCBEGIN #### Find-push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find_push` is used to find a certain element in an array and, if not found, push it onto the array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##find_push(mumaResult* result, struct_name s, type find, size_m* p_index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function tries to find `find` in the given array `s` using `function_name_prefix##find` and, if not found, pushes `find` onto the array. In either case, if successful and `p_index` isn't 0, `p_index` is dereferenced and set to the index that contains `find`. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##find_push(mumaResult* result, struct_name s, type find, size_m* p_index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaResult res = MUMA_SUCCESS; \
 					size_m index = function_name_prefix##find(&res, s, find); \
 					if (index != MU_SIZE_MAX) { \
 						if (p_index != MU_NULL_PTR) { \
@@ -895,47 +1661,7021 @@ Note that mu libraries store their dependencies within their files, so you don't
 					return s; \
 				}
 
-		// @DOCLINE ## Version
+			#define mu_dynamic_array_declaration(struct_name, type, function_name_prefix, type_comparison_func) \
+				mu_dynamic_array_struct(struct_name, type) \
+				mu_dynamic_array_definitions(struct_name, type, function_name_prefix, type_comparison_func, , muma_dynamic_array_capacity)
 
-			// @DOCLINE There are three major, minor, and patch macros respectively defined to represent the version of mum, defined as `MUMA_VERSION_MAJOR`, `MUMA_VERSION_MINOR`, and `MUMA_VERSION_PATCH`, following the formatting of `vMAJOR.MINOR.PATCH`.
+			#define mu_dynamic_array_header(struct_name, type, function_name_prefix, type_comparison_func) \
+				mu_dynamic_array_struct(struct_name, type) \
+				mu_dynamic_array_prototypes(struct_name, type, function_name_prefix, )
 
-			#define MUMA_VERSION_MAJOR 1
-			#define MUMA_VERSION_MINOR 1
-			#define MUMA_VERSION_PATCH 0
+			#define mu_dynamic_array_impl(struct_name, type, function_name_prefix, type_comparison_func) \
+				mu_dynamic_array_definitions(struct_name, type, function_name_prefix, type_comparison_func, , muma_dynamic_array_capacity)
 
-	// @DOCLINE # Functions
+			#define mu_dynamic_array_static_declaration(struct_name, type, function_name_prefix, type_comparison_func) \
+				mu_dynamic_array_struct(struct_name, type) \
+				mu_dynamic_array_definitions(struct_name, type, function_name_prefix, type_comparison_func, static MUMA_INLINE, muma_dynamic_array_capacity)
 
-		// @DOCLINE ## Name function
+		// @DOCLINE ## Dynamic array sorting
 
-			#ifdef MUMA_NAMES
-				// @DOCLINE The function `muma_result_get_name` is used to get a `const char*` representation of a `mumaResult` value, defined below: @NLNT
-				MUDEF const char* muma_result_get_name(mumaResult result);
-				// @DOCLINE Note that this function is only defined if the macro `MUMA_NAMES` is defined.
-			#endif
+			/* @DOCBEGIN
 
-	#ifdef __cplusplus
-		}
-	#endif
+			The macro `mu_dynamic_array_sort_declaration` is a macro function that is used to define sorting functions for a dynamic array that has already been declared. Its parameters look like this:
 
-#endif /* MUMA_H */
+			```c
+			mu_dynamic_array_sort_declaration(struct_name, type, function_name_prefix, less_func)
+			```
 
-#ifdef MUMA_IMPLEMENTATION
+			`struct_name`, `type`, and `function_name_prefix` must be the same as the ones that the dynamic array was declared with.
 
-	/* muUtility version 1.0.0 implementation */
+			`less_func` is the name of a function or macro function that takes in two parameters of type `type` and returns whether or not the first one should be sorted before the second one. Since it is called directly instead of through a function pointer (unlike with `qsort`), the compiler is able to inline it.
 
-		#ifndef MUU_IMPLEMENTATION
-			#define MUU_IMPLEMENTATION
+			The sort is an introsort: a quicksort (with a median-of-three pivot) that switches to a heap sort if it recurses too deeply, guaranteeing O(n log n), and to an insertion sort for small ranges. It is not stable.
 
-			#ifdef MUU_IMPLEMENTATION
-	
-				// ...
+			### Linkage
 
-			#endif /* MUU_IMPLEMENTATION */
-		#endif
+			`mu_dynamic_array_sort_declaration` defines its functions with external linkage, so, like the dynamic array itself, it can only be expanded in one translation unit. It has the same variants as the dynamic array (see the dynamic array's linkage section), which take the same parameters:
 
-	#ifdef __cplusplus
-		extern "C" {
-	#endif
+			```c
+			mu_dynamic_array_sort_header(struct_name, type, function_name_prefix, less_func)
+			mu_dynamic_array_sort_impl(struct_name, type, function_name_prefix, less_func)
+			mu_dynamic_array_sort_static_declaration(struct_name, type, function_name_prefix, less_func)
+			```
+
+			`mu_dynamic_array_sort_header` only declares the functions, and is meant to follow `mu_dynamic_array_header`; `mu_dynamic_array_sort_impl` defines them in one translation unit; `mu_dynamic_array_sort_static_declaration` defines them as `static inline`. They are built on `mu_dynamic_array_sort_prototypes(struct_name, type, function_name_prefix, linkage)` and `mu_dynamic_array_sort_definitions(struct_name, type, function_name_prefix, less_func, linkage)`.
+
+			### Functions
+
+			The following is a list of all of the functions defined by the macro.
+
+			@DOCEND */
+
+			#define MUMA_SORT_INSERTION_THRESHOLD 16
+
+			#define mu_dynamic_array_sort_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##sort(mumaResult* result, struct_name s); \
+				linkage muBool function_name_prefix##is_sorted(struct_name s); \
+				linkage struct_name function_name_prefix##unique(mumaResult* result, struct_name s); \
+				linkage void function_name_prefix##find_many(mumaResult* result, struct_name s, const type* keys, size_m key_count, size_m* indices);
+
+			#define mu_dynamic_array_sort_definitions(struct_name, type, function_name_prefix, less_func, linkage) \
+				\
+				static void function_name_prefix##inner_insertion_sort(type* data, size_m length) { \
+					for (size_m i = 1; i < length; i++) { \
+						type value = data[i]; \
+						size_m j = i; \
+						while (j > 0 && less_func(value, data[j-1])) { \
+							data[j] = data[j-1]; \
+							j--; \
+						} \
+						data[j] = value; \
+					} \
+				} \
+				\
+				static void function_name_prefix##inner_heap_sort(type* data, size_m length) { \
+					for (size_m n = length; n > 0; n--) { \
+						/* Sift down from every parent on the first pass (building */ \
+						/* the heap), then from the root after each extraction. */ \
+						size_m start = (n == length) ? length/2 : 1; \
+						if (n != length) { \
+							type top = data[0]; \
+							data[0] = data[n]; \
+							data[n] = top; \
+						} \
+						while (start > 0) { \
+							start--; \
+							size_m root = start; \
+							for (;;) { \
+								size_m child = root*2 + 1; \
+								if (child >= n) { \
+									break; \
+								} \
+								if (child+1 < n && less_func(data[child], data[child+1])) { \
+									child++; \
+								} \
+								if (!less_func(data[root], data[child])) { \
+									break; \
+								} \
+								type t = data[root]; \
+								data[root] = data[child]; \
+								data[child] = t; \
+								root = child; \
+							} \
+						} \
+					} \
+				} \
+				\
+				static void function_name_prefix##inner_sort(type* data, size_m length, size_m depth) { \
+					while (length > MUMA_SORT_INSERTION_THRESHOLD) { \
+						if (depth == 0) { \
+							function_name_prefix##inner_heap_sort(data, length); \
+							return; \
+						} \
+						depth--; \
+						\
+						/* Median of three, which also leaves sentinels at both ends */ \
+						size_m mid = length/2; \
+						type t; \
+						if (less_func(data[mid], data[0])) { t = data[mid]; data[mid] = data[0]; data[0] = t; } \
+						if (less_func(data[length-1], data[mid])) { \
+							t = data[mid]; data[mid] = data[length-1]; data[length-1] = t; \
+							if (less_func(data[mid], data[0])) { t = data[mid]; data[mid] = data[0]; data[0] = t; } \
+						} \
+						type pivot = data[mid]; \
+						\
+						/* Hoare partition */ \
+						size_m i = 0; \
+						size_m j = length-1; \
+						for (;;) { \
+							while (less_func(data[i], pivot)) { \
+								i++; \
+							} \
+							while (less_func(pivot, data[j])) { \
+								j--; \
+							} \
+							if (i >= j) { \
+								break; \
+							} \
+							t = data[i]; data[i] = data[j]; data[j] = t; \
+							i++; \
+							j--; \
+						} \
+						\
+						/* Recurse into the smaller side and loop on the larger one */ \
+						if (j+1 < length-(j+1)) { \
+							function_name_prefix##inner_sort(data, j+1, depth); \
+							data += j+1; \
+							length -= j+1; \
+						} else { \
+							function_name_prefix##inner_sort(&data[j+1], length-(j+1), depth); \
+							length = j+1; \
+						} \
+					} \
+					function_name_prefix##inner_insertion_sort(data, length); \
+				} \
+				\
+				/*@DOCBEGIN #### Sort @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##sort` is used to sort the elements of a dynamic array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##sort(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that this function never allocates memory. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##sort(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m depth = 0; \
+					for (size_m n = s.length; n > 1; n /= 2) { \
+						depth += 2; \
+					} \
+					function_name_prefix##inner_sort(s.data, s.length, depth); \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Is sorted @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##is_sorted` is used to check if the elements of a dynamic array are sorted, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##is_sorted(struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##is_sorted(struct_name s) { \
+					for (size_m i = 1; i < s.length; i++) { \
+						if (less_func(s.data[i], s.data[i-1])) { \
+							return MU_FALSE; \
+						} \
+					} \
+					return MU_TRUE; \
+				} \
+				\
+				/*@DOCBEGIN #### Unique @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##unique` is used to remove duplicate elements from a sorted dynamic array in place, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##unique(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Two elements are considered duplicates if neither is less than the other; only the first of every run of duplicates is kept, and the order of the kept elements doesn't change. Note that the array must already be sorted, or else only adjacent duplicates are removed. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##unique(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length < 2) { \
+						return s; \
+					} \
+					\
+					size_m write = 1; \
+					for (size_m i = 1; i < s.length; i++) { \
+						/* Only equivalent elements are dropped, so unsorted */ \
+						/* input keeps everything but adjacent duplicates */ \
+						if (less_func(s.data[write-1], s.data[i]) || less_func(s.data[i], s.data[write-1])) { \
+							if (write != i) { \
+								s.data[write] = s.data[i]; \
+							} \
+							write++; \
+						} \
+					} \
+					\
+					return function_name_prefix##resize(result, s, write); \
+				} \
+				\
+				/* Index of the first key in `keys` (sorted) that isn't less */ \
+				/* than `value`, or `count` if there's none */ \
+				static size_m function_name_prefix##inner_lower_bound(const type* keys, size_m count, type value) { \
+					size_m low = 0; \
+					while (count > 0) { \
+						size_m half = count/2; \
+						if (less_func(keys[low+half], value)) { \
+							low += half+1; \
+							count -= half+1; \
+						} else { \
+							count = half; \
+						} \
+					} \
+					return low; \
+				} \
+				\
+				/*@DOCBEGIN #### Find many @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find_many` is used to find several elements in a dynamic array with a single pass over it, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##find_many(mumaResult* result, struct_name s, const type* keys, size_m key_count, size_m* indices) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN For every `i` below `key_count`, `indices[i]` is set to the index of the first element of `s` equal to `keys[i]`, or `MU_SIZE_MAX` if there is none, in which case `MUMA_NOT_FOUND` is the result (the other keys are still found). Two elements are considered equal if neither is less than the other (like in `function_name_prefix##unique`), rather than by `type_comparison_func`. @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN A sorted copy of the keys is made (allocated through `muma_malloc`), and every element of the array is looked up in it with a binary search, making this O((`s.length` + `key_count`) log `key_count`) instead of the O(`s.length` * `key_count`) of calling `function_name_prefix##find` for every key; the scan stops early once every key has been found. The array doesn't need to be sorted. If the sorted copy can't be allocated (or its size would overflow), every index is left as `MU_SIZE_MAX` and the allocation's result (such as `MUMA_FAILED_TO_ALLOCATE`) is returned. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##find_many(mumaResult* result, struct_name s, const type* keys, size_m key_count, size_m* indices) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					for (size_m i = 0; i < key_count; i++) { \
+						indices[i] = MU_SIZE_MAX; \
+					} \
+					if (key_count == 0) { \
+						return; \
+					} \
+					\
+					/* The first index found for every sorted key, followed by */ \
+					/* the sorted keys themselves. The keys are aligned to the */ \
+					/* largest power of 2 dividing sizeof(type) (a multiple of */ \
+					/* its alignment), and to at least 16 bytes. */ \
+					size_m align = sizeof(type) & (0 - sizeof(type)); \
+					if (align < 16) { \
+						align = 16; \
+					} \
+					if (key_count > (MU_SIZE_MAX - align) / (sizeof(size_m) + sizeof(type))) { \
+						MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE) \
+						return; \
+					} \
+					size_m size = (sizeof(size_m) + sizeof(type))*key_count + align-1; \
+					mumaResult res = MUMA_SUCCESS; \
+					muByte* memory = (muByte*)muma_malloc(&res, size); \
+					if (memory == 0) { \
+						MU_SET_RESULT(result, res) \
+						return; \
+					} \
+					size_m* found = (size_m*)memory; \
+					muByte* keys_start = memory + sizeof(size_m)*key_count; \
+					type* sorted = (type*)(keys_start + ((align - ((size_m)keys_start & (align-1))) & (align-1))); \
+					\
+					mu_memcpy(sorted, keys, sizeof(type)*key_count); \
+					size_m depth = 0; \
+					for (size_m n = key_count; n > 1; n /= 2) { \
+						depth += 2; \
+					} \
+					function_name_prefix##inner_sort(sorted, key_count, depth); \
+					\
+					size_m unique_count = 1; \
+					for (size_m i = 1; i < key_count; i++) { \
+						if (less_func(sorted[unique_count-1], sorted[i])) { \
+							sorted[unique_count++] = sorted[i]; \
+						} \
+					} \
+					for (size_m i = 0; i < unique_count; i++) { \
+						found[i] = MU_SIZE_MAX; \
+					} \
+					\
+					size_m remaining = unique_count; \
+					for (size_m i = 0; i < s.length && remaining != 0; i++) { \
+						size_m k = function_name_prefix##inner_lower_bound(sorted, unique_count, s.data[i]); \
+						if (k < unique_count && found[k] == MU_SIZE_MAX && !less_func(s.data[i], sorted[k])) { \
+							found[k] = i; \
+							remaining--; \
+						} \
+					} \
+					\
+					for (size_m i = 0; i < key_count; i++) { \
+						indices[i] = found[function_name_prefix##inner_lower_bound(sorted, unique_count, keys[i])]; \
+						if (indices[i] == MU_SIZE_MAX) { \
+							MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+						} \
+					} \
+					\
+					muma_free(memory, size); \
+				}
+
+			#define mu_dynamic_array_sort_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_sort_definitions(struct_name, type, function_name_prefix, less_func, )
+
+			#define mu_dynamic_array_sort_header(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_sort_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_dynamic_array_sort_impl(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_sort_definitions(struct_name, type, function_name_prefix, less_func, )
+
+			#define mu_dynamic_array_sort_static_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_sort_definitions(struct_name, type, function_name_prefix, less_func, static MUMA_INLINE)
+
+			/* @DOCBEGIN
+
+			### Radix sort
+
+			The macro `mu_dynamic_array_radix_sort_declaration` is a macro function that is used to define a radix sort for a dynamic array that has already been declared, which sorts by an integer key of each element instead of comparing elements, and is usually several times faster than a comparison sort for large arrays. Its parameters look like this:
+
+			```c
+			mu_dynamic_array_radix_sort_declaration(struct_name, type, function_name_prefix, key_func)
+			```
+
+			`struct_name`, `type`, and `function_name_prefix` must be the same as the ones that the dynamic array was declared with.
+
+			`key_func` is the name of a function or macro function that takes in a parameter of type `type` and returns a `uint64_m` key, with the elements being sorted by their keys in ascending order. Unsigned integers can be used as keys directly; for other keys, the following functions return keys that sort in the same order as the given value:
+
+			```c
+			uint64_m muma_radix_key_int32(int32_m v);
+			uint64_m muma_radix_key_int64(int64_m v);
+			uint64_m muma_radix_key_float(float v);
+			uint64_m muma_radix_key_double(double v);
+			```
+
+			Note that negative zero is sorted before positive zero, and NaNs are sorted to the ends based on their sign.
+
+			The sort is a stable least-significant-digit radix sort that goes over the keys one byte at a time, skipping every byte that is the same for all keys (meaning that, for example, keys that fit in 32 bits only take four passes). It needs a temporary copy of the array, which is allocated through `muma_malloc`.
+
+			#### Radix sort function
+
+			The function `function_name_prefix##radix_sort` is used to sort the elements of a dynamic array by their keys, defined below:
+
+			```c
+			struct_name function_name_prefix##radix_sort(mumaResult* result, struct_name s)
+			```
+
+			If the temporary copy can't be allocated, the array isn't modified.
+
+			#### Radix sort linkage
+
+			Like the comparison sort, the radix sort can also be split between a header and one translation unit, or defined as `static inline`, with the following macros that take the same parameters (see the dynamic array's linkage section):
+
+			```c
+			mu_dynamic_array_radix_sort_header(struct_name, type, function_name_prefix, key_func)
+			mu_dynamic_array_radix_sort_impl(struct_name, type, function_name_prefix, key_func)
+			mu_dynamic_array_radix_sort_static_declaration(struct_name, type, function_name_prefix, key_func)
+			```
+
+			They are built on `mu_dynamic_array_radix_sort_prototypes(struct_name, function_name_prefix, linkage)` and `mu_dynamic_array_radix_sort_definitions(struct_name, type, function_name_prefix, key_func, linkage)`.
+
+			@DOCEND */
+
+			static MUMA_INLINE uint64_m muma_radix_key_int32(int32_m v) {
+				return (uint64_m)(uint32_m)v ^ (uint64_m)0x80000000;
+			}
+
+			static MUMA_INLINE uint64_m muma_radix_key_int64(int64_m v) {
+				return (uint64_m)v ^ ((uint64_m)1 << 63);
+			}
+
+			static MUMA_INLINE uint64_m muma_radix_key_float(float v) {
+				uint32_m bits;
+				mu_memcpy(&bits, &v, sizeof(bits));
+				return (bits & (uint32_m)0x80000000) ? (uint64_m)(uint32_m)~bits : (uint64_m)(bits | (uint32_m)0x80000000);
+			}
+
+			static MUMA_INLINE uint64_m muma_radix_key_double(double v) {
+				uint64_m bits;
+				mu_memcpy(&bits, &v, sizeof(bits));
+				return (bits & ((uint64_m)1 << 63)) ? ~bits : (bits | ((uint64_m)1 << 63));
+			}
+
+			#define mu_dynamic_array_radix_sort_prototypes(struct_name, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##radix_sort(mumaResult* result, struct_name s);
+
+			#define mu_dynamic_array_radix_sort_definitions(struct_name, type, function_name_prefix, key_func, linkage) \
+				\
+				linkage struct_name function_name_prefix##radix_sort(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length < 2) { \
+						return s; \
+					} \
+					\
+					/* One histogram per key byte, all filled in a single pass */ \
+					size_m counts[8][256]; \
+					mu_memset(counts, 0, sizeof(counts)); \
+					for (size_m i = 0; i < s.length; i++) { \
+						uint64_m key = key_func(s.data[i]); \
+						for (size_m b = 0; b < 8; b++) { \
+							counts[b][(key >> (b*8)) & 0xFF]++; \
+						} \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					type* temp = (type*)muma_malloc(&res, sizeof(type)*s.length); \
+					if (temp == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					type* src = s.data; \
+					type* dst = temp; \
+					uint64_m first_key = key_func(s.data[0]); \
+					for (size_m b = 0; b < 8; b++) { \
+						if (counts[b][(first_key >> (b*8)) & 0xFF] == s.length) { \
+							continue; \
+						} \
+						\
+						size_m offset = 0; \
+						for (size_m d = 0; d < 256; d++) { \
+							size_m count = counts[b][d]; \
+							counts[b][d] = offset; \
+							offset += count; \
+						} \
+						for (size_m i = 0; i < s.length; i++) { \
+							dst[counts[b][(key_func(src[i]) >> (b*8)) & 0xFF]++] = src[i]; \
+						} \
+						\
+						type* t = src; \
+						src = dst; \
+						dst = t; \
+					} \
+					\
+					if (src != s.data) { \
+						mu_memcpy(s.data, src, sizeof(type)*s.length); \
+					} \
+					muma_free(temp, sizeof(type)*s.length); \
+					return s; \
+				}
+
+			#define mu_dynamic_array_radix_sort_declaration(struct_name, type, function_name_prefix, key_func) \
+				mu_dynamic_array_radix_sort_definitions(struct_name, type, function_name_prefix, key_func, )
+
+			#define mu_dynamic_array_radix_sort_header(struct_name, type, function_name_prefix, key_func) \
+				mu_dynamic_array_radix_sort_prototypes(struct_name, function_name_prefix, )
+
+			#define mu_dynamic_array_radix_sort_impl(struct_name, type, function_name_prefix, key_func) \
+				mu_dynamic_array_radix_sort_definitions(struct_name, type, function_name_prefix, key_func, )
+
+			#define mu_dynamic_array_radix_sort_static_declaration(struct_name, type, function_name_prefix, key_func) \
+				mu_dynamic_array_radix_sort_definitions(struct_name, type, function_name_prefix, key_func, static MUMA_INLINE)
+
+			/* @DOCBEGIN
+
+			### Parallel sort
+
+			The macro `mu_dynamic_array_parallel_sort_declaration` is a macro function that is used to define multi-threaded sorting and merging functions for a dynamic array that has already been declared, and that has already had `mu_dynamic_array_sort_declaration` expanded for it. Its parameters look like this:
+
+			```c
+			mu_dynamic_array_parallel_sort_declaration(struct_name, type, function_name_prefix, less_func)
+			```
+
+			The parameters are the same as the ones given to `mu_dynamic_array_sort_declaration`.
+
+			Both functions split the work between threads with `muma_parallel_run`, using a sample of the elements to split the output into parts of roughly the same size (parallel sorting by regular sampling). Note that an array where a large amount of elements are equivalent splits less evenly, and gets less of a speedup.
+
+			For both functions, `thread_count` is the maximum amount of threads used, including the calling thread, with 0 meaning `muma_thread_count()`. Less threads are used for small arrays, where starting threads would cost more than it saves.
+
+			#### Parallel sort function
+
+			The function `function_name_prefix##parallel_sort` is used to sort the elements of a dynamic array using several threads, defined below:
+
+			```c
+			struct_name function_name_prefix##parallel_sort(mumaResult* result, struct_name s, size_m thread_count)
+			```
+
+			The array is split into one chunk per thread, each of which is sorted with `function_name_prefix##sort`, and the sorted chunks are then merged in parallel into a single scratch allocation (which replaces the array's allocation, meaning that `s.data` changes). If the scratch allocation can't be made, the array is sorted on the calling thread instead.
+
+			#### Parallel merge function
+
+			The function `function_name_prefix##parallel_merge` is used to merge several sorted dynamic arrays into a new sorted dynamic array using several threads, defined below:
+
+			```c
+			struct_name function_name_prefix##parallel_merge(mumaResult* result, struct_name* arrays, size_m count, size_m thread_count)
+			```
+
+			`arrays` is a list of `count` arrays, each of which must already be sorted; they are not modified. The returned array must be destroyed with `function_name_prefix##destroy`.
+
+			#### Parallel sort linkage
+
+			The parallel sort has the same linkage variants as the comparison sort, which take the same parameters and should be paired with the matching variants of `mu_dynamic_array_sort_declaration`:
+
+			```c
+			mu_dynamic_array_parallel_sort_header(struct_name, type, function_name_prefix, less_func)
+			mu_dynamic_array_parallel_sort_impl(struct_name, type, function_name_prefix, less_func)
+			mu_dynamic_array_parallel_sort_static_declaration(struct_name, type, function_name_prefix, less_func)
+			```
+
+			They are built on `mu_dynamic_array_parallel_sort_prototypes(struct_name, function_name_prefix, linkage)` and `mu_dynamic_array_parallel_sort_definitions(struct_name, type, function_name_prefix, less_func, linkage)`.
+
+			@DOCEND */
+
+			// Smallest amount of elements per thread worth parallelizing
+			#define MUMA_PARALLEL_SORT_MIN 16384
+			// Maximum amount of threads used by a parallel sort
+			#define MUMA_PARALLEL_SORT_MAX_THREADS 256
+
+			#define mu_dynamic_array_parallel_sort_prototypes(struct_name, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##parallel_sort(mumaResult* result, struct_name s, size_m thread_count); \
+				linkage struct_name function_name_prefix##parallel_merge(mumaResult* result, struct_name* arrays, size_m count, size_m thread_count);
+
+			#define mu_dynamic_array_parallel_sort_definitions(struct_name, type, function_name_prefix, less_func, linkage) \
+				\
+				/* Work shared by the threads of a partitioned merge; part p of */ \
+				/* run r is [bounds[p*run_count+r], bounds[(p+1)*run_count+r]) */ \
+				struct struct_name##_inner_merge { \
+					type** runs; \
+					size_m run_count; \
+					size_m* bounds; \
+					size_m* offsets; \
+					size_m* scratch; \
+					type* out; \
+				}; \
+				\
+				struct struct_name##_inner_chunks { \
+					type* data; \
+					size_m length; \
+					size_m parts; \
+				}; \
+				\
+				/* Merges the given ranges of k sorted runs using a heap of run indexes */ \
+				static void function_name_prefix##inner_kway_merge(type** runs, size_m* cursor, size_m* end, size_m* heap, size_m k, type* out) { \
+					size_m count = 0; \
+					for (size_m r = 0; r < k; r++) { \
+						if (cursor[r] < end[r]) { \
+							heap[count++] = r; \
+						} \
+					} \
+					\
+					size_m i = count/2; \
+					for (;;) { \
+						/* Sift heap[i] down; once heapified, i is always 0 */ \
+						size_m root = i; \
+						for (;;) { \
+							size_m child = root*2 + 1; \
+							if (child >= count) { \
+								break; \
+							} \
+							if (child+1 < count && less_func(runs[heap[child+1]][cursor[heap[child+1]]], runs[heap[child]][cursor[heap[child]]])) { \
+								child++; \
+							} \
+							if (!less_func(runs[heap[child]][cursor[heap[child]]], runs[heap[root]][cursor[heap[root]]])) { \
+								break; \
+							} \
+							size_m t = heap[root]; \
+							heap[root] = heap[child]; \
+							heap[child] = t; \
+							root = child; \
+						} \
+						if (i > 0) { \
+							i--; \
+							continue; \
+						} \
+						if (count <= 1) { \
+							break; \
+						} \
+						\
+						size_m r = heap[0]; \
+						*out++ = runs[r][cursor[r]++]; \
+						if (cursor[r] == end[r]) { \
+							heap[0] = heap[--count]; \
+						} \
+					} \
+					\
+					if (count == 1) { \
+						size_m r = heap[0]; \
+						mu_memcpy(out, &runs[r][cursor[r]], sizeof(type)*(end[r]-cursor[r])); \
+					} \
+				} \
+				\
+				static void function_name_prefix##inner_merge_task(void* user_data, size_m p) { \
+					struct struct_name##_inner_merge* m = (struct struct_name##_inner_merge*)user_data; \
+					size_m* cursor = &m->scratch[p*2*m->run_count]; \
+					size_m* heap = cursor + m->run_count; \
+					mu_memcpy(cursor, &m->bounds[p*m->run_count], sizeof(size_m)*m->run_count); \
+					function_name_prefix##inner_kway_merge(m->runs, cursor, &m->bounds[(p+1)*m->run_count], heap, m->run_count, &m->out[m->offsets[p]]); \
+				} \
+				\
+				/* Merges k sorted runs into out, split into `parts` parts merged in parallel */ \
+				static mumaResult function_name_prefix##inner_parallel_merge(type** runs, size_m* lengths, size_m k, type* out, size_m parts) { \
+					mumaResult res = MUMA_SUCCESS; \
+					size_m sample_count = k*parts; \
+					size_m index_count = (parts+1)*k + (parts+1) + 2*parts*k; \
+					type* samples = (type*)muma_malloc(&res, sizeof(type)*sample_count); \
+					if (samples == 0) { \
+						return res; \
+					} \
+					size_m* indexes = (size_m*)muma_malloc(&res, sizeof(size_m)*index_count); \
+					if (indexes == 0) { \
+						muma_free(samples, sizeof(type)*sample_count); \
+						return res; \
+					} \
+					\
+					struct struct_name##_inner_merge m; \
+					m.runs = runs; \
+					m.run_count = k; \
+					m.bounds = indexes; \
+					m.offsets = &indexes[(parts+1)*k]; \
+					m.scratch = &m.offsets[parts+1]; \
+					m.out = out; \
+					\
+					/* Regular samples of every run pick the splitters */ \
+					size_m sampled = 0; \
+					for (size_m r = 0; r < k; r++) { \
+						if (lengths[r] == 0) { \
+							continue; \
+						} \
+						for (size_m j = 0; j < parts; j++) { \
+							samples[sampled++] = runs[r][(j*lengths[r])/parts + lengths[r]/(2*parts)]; \
+						} \
+					} \
+					size_m depth = 0; \
+					for (size_m n = sampled; n > 1; n /= 2) { \
+						depth += 2; \
+					} \
+					function_name_prefix##inner_sort(samples, sampled, depth); \
+					\
+					for (size_m r = 0; r < k; r++) { \
+						m.bounds[r] = 0; \
+						m.bounds[parts*k + r] = lengths[r]; \
+					} \
+					for (size_m p = 1; p < parts; p++) { \
+						type splitter = samples[(p*sampled)/parts]; \
+						for (size_m r = 0; r < k; r++) { \
+							/* Lower bound of the splitter in run r */ \
+							size_m low = m.bounds[(p-1)*k + r]; \
+							size_m high = lengths[r]; \
+							while (low < high) { \
+								size_m mid = low + (high-low)/2; \
+								if (less_func(runs[r][mid], splitter)) { \
+									low = mid+1; \
+								} else { \
+									high = mid; \
+								} \
+							} \
+							m.bounds[p*k + r] = low; \
+						} \
+					} \
+					for (size_m p = 0; p <= parts; p++) { \
+						m.offsets[p] = 0; \
+						for (size_m r = 0; r < k; r++) { \
+							m.offsets[p] += m.bounds[p*k + r]; \
+						} \
+					} \
+					\
+					muma_parallel_run(parts, function_name_prefix##inner_merge_task, &m); \
+					\
+					muma_free(indexes, sizeof(size_m)*index_count); \
+					muma_free(samples, sizeof(type)*sample_count); \
+					return res; \
+				} \
+				\
+				static void function_name_prefix##inner_chunk_task(void* user_data, size_m p) { \
+					struct struct_name##_inner_chunks* c = (struct struct_name##_inner_chunks*)user_data; \
+					struct_name chunk = MU_ZERO_STRUCT(struct_name); \
+					size_m begin = (p*c->length)/c->parts; \
+					chunk.data = &c->data[begin]; \
+					chunk.length = ((p+1)*c->length)/c->parts - begin; \
+					chunk.allocated_length = chunk.length; \
+					function_name_prefix##sort(MU_NULL_PTR, chunk); \
+				} \
+				\
+				static size_m function_name_prefix##inner_parallel_parts(size_m length, size_m thread_count) { \
+					if (thread_count == 0) { \
+						thread_count = muma_thread_count(); \
+					} \
+					if (thread_count > MUMA_PARALLEL_SORT_MAX_THREADS) { \
+						thread_count = MUMA_PARALLEL_SORT_MAX_THREADS; \
+					} \
+					if (length/MUMA_PARALLEL_SORT_MIN < thread_count) { \
+						thread_count = length/MUMA_PARALLEL_SORT_MIN; \
+					} \
+					return (thread_count == 0) ? 1 : thread_count; \
+				} \
+				\
+				linkage struct_name function_name_prefix##parallel_sort(mumaResult* result, struct_name s, size_m thread_count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m parts = function_name_prefix##inner_parallel_parts(s.length, thread_count); \
+					if (parts <= 1) { \
+						return function_name_prefix##sort(result, s); \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					type* scratch = (type*)muma_malloc(&res, sizeof(type)*s.allocated_length); \
+					if (scratch == 0) { \
+						return function_name_prefix##sort(result, s); \
+					} \
+					\
+					struct struct_name##_inner_chunks c; \
+					c.data = s.data; \
+					c.length = s.length; \
+					c.parts = parts; \
+					muma_parallel_run(parts, function_name_prefix##inner_chunk_task, &c); \
+					\
+					type* runs[MUMA_PARALLEL_SORT_MAX_THREADS]; \
+					size_m lengths[MUMA_PARALLEL_SORT_MAX_THREADS]; \
+					for (size_m p = 0; p < parts; p++) { \
+						size_m begin = (p*s.length)/parts; \
+						runs[p] = &s.data[begin]; \
+						lengths[p] = ((p+1)*s.length)/parts - begin; \
+					} \
+					\
+					res = function_name_prefix##inner_parallel_merge(runs, lengths, parts, scratch, parts); \
+					if (res != MUMA_SUCCESS) { \
+						/* The chunks are still in place, just not merged */ \
+						muma_free(scratch, sizeof(type)*s.allocated_length); \
+						return function_name_prefix##sort(result, s); \
+					} \
+					\
+					muma_free(s.data, sizeof(type)*s.allocated_length); \
+					s.data = scratch; \
+					return s; \
+				} \
+				\
+				linkage struct_name function_name_prefix##parallel_merge(mumaResult* result, struct_name* arrays, size_m count, size_m thread_count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m length = 0; \
+					for (size_m i = 0; i < count; i++) { \
+						length += arrays[i].length; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					struct_name s = function_name_prefix##create(&res, length); \
+					if (res != MUMA_SUCCESS || length == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					size_m lists_size = (sizeof(type*)+sizeof(size_m))*count; \
+					type** runs = (type**)muma_malloc(&res, lists_size); \
+					if (runs == 0) { \
+						MU_SET_RESULT(result, res) \
+						return function_name_prefix##destroy(MU_NULL_PTR, s); \
+					} \
+					size_m* lengths = (size_m*)&runs[count]; \
+					for (size_m i = 0; i < count; i++) { \
+						runs[i] = arrays[i].data; \
+						lengths[i] = arrays[i].length; \
+					} \
+					\
+					size_m parts = function_name_prefix##inner_parallel_parts(length, thread_count); \
+					res = function_name_prefix##inner_parallel_merge(runs, lengths, count, s.data, parts); \
+					muma_free(runs, lists_size); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return function_name_prefix##destroy(MU_NULL_PTR, s); \
+					} \
+					return s; \
+				}
+
+			#define mu_dynamic_array_parallel_sort_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_parallel_sort_definitions(struct_name, type, function_name_prefix, less_func, )
+
+			#define mu_dynamic_array_parallel_sort_header(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_parallel_sort_prototypes(struct_name, function_name_prefix, )
+
+			#define mu_dynamic_array_parallel_sort_impl(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_parallel_sort_definitions(struct_name, type, function_name_prefix, less_func, )
+
+			#define mu_dynamic_array_parallel_sort_static_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dynamic_array_parallel_sort_definitions(struct_name, type, function_name_prefix, less_func, static MUMA_INLINE)
+
+		// @DOCLINE ## Heap
+
+			/* @DOCBEGIN
+
+			The macro `mu_heap_declaration` is a macro function that is used to create a heap, which is a priority queue that gives O(1) access to its smallest element, and pushes and pops elements in O(log n). Its parameters look like this:
+
+			```c
+			mu_heap_declaration(struct_name, type, function_name_prefix, less_func)
+			```
+
+			`struct_name` is the desired name of the heap struct that will be created for the given type.
+
+			`type` is the type that will be used to represent an element in the heap.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			`less_func` is the name of a function or macro function that takes in two parameters of type `type` and returns whether or not the first one is less than the second one. The top of the heap is always an element that no other element is less than; to get the largest element on top instead, `less_func` can just be reversed.
+
+			### D-ary heap
+
+			`mu_heap_declaration` creates a binary heap (where each element has two children). The macro `mu_dary_heap_declaration` can be used instead to create a heap where each element has `arity` children, which has the same parameters plus the arity at the end:
+
+			```c
+			mu_dary_heap_declaration(struct_name, type, function_name_prefix, less_func, arity)
+			```
+
+			A 4-ary heap is half as deep as a binary heap and keeps the children of an element next to each other in memory, which usually makes it faster than a binary heap for large heaps, especially when pushing is common; popping does more comparisons per level, but goes through half the levels. `mu_heap_declaration` is equivalent to `mu_dary_heap_declaration` with an `arity` of 2.
+
+			### Struct
+
+			The heap expands to do a few things. The first thing it does is create a struct for the heap, following this expansion:
+
+			```c
+			struct struct_name {
+				type* data;
+				size_m allocated_length;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`data` holds the `length` elements of the heap in heap order, with `data[0]` being the top of the heap.
+
+			Note that these members aren't meant to be modified by the user, only read.
+
+			Note that this is the same layout as a dynamic array's, and that a heap's memory is allocated the same way, meaning that the members of a dynamic array can be moved into a heap struct (and then heapified with `function_name_prefix##heapify`), and vice versa.
+
+			Note that a heap's allocation is only ever grown (doubling in size), never shrunk, until the heap is destroyed.
+
+			### Linkage
+
+			Both heap macros define their functions with external linkage, so they can only be expanded in one translation unit. As with dynamic arrays (see the dynamic array's linkage section), each one has variants with the same parameters that split the struct and prototypes from the definitions, or that define everything as `static inline`:
+
+			```c
+			mu_heap_header(struct_name, type, function_name_prefix, less_func)
+			mu_heap_impl(struct_name, type, function_name_prefix, less_func)
+			mu_heap_static_declaration(struct_name, type, function_name_prefix, less_func)
+
+			mu_dary_heap_header(struct_name, type, function_name_prefix, less_func, arity)
+			mu_dary_heap_impl(struct_name, type, function_name_prefix, less_func, arity)
+			mu_dary_heap_static_declaration(struct_name, type, function_name_prefix, less_func, arity)
+			```
+
+			The d-ary variants are built on `mu_dary_heap_struct(struct_name, type)`, `mu_dary_heap_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_dary_heap_definitions(struct_name, type, function_name_prefix, less_func, arity, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			#define mu_heap_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dary_heap_declaration(struct_name, type, function_name_prefix, less_func, 2)
+
+			#define mu_heap_header(struct_name, type, function_name_prefix, less_func) \
+				mu_dary_heap_header(struct_name, type, function_name_prefix, less_func, 2)
+
+			#define mu_heap_impl(struct_name, type, function_name_prefix, less_func) \
+				mu_dary_heap_impl(struct_name, type, function_name_prefix, less_func, 2)
+
+			#define mu_heap_static_declaration(struct_name, type, function_name_prefix, less_func) \
+				mu_dary_heap_static_declaration(struct_name, type, function_name_prefix, less_func, 2)
+
+			#define mu_dary_heap_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					type* data; \
+					size_m allocated_length; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_dary_heap_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length); \
+				linkage struct_name function_name_prefix##create_from(mumaResult* result, type* data, size_m count); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##heapify(mumaResult* result, struct_name s); \
+				linkage type* function_name_prefix##top(struct_name s); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value); \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s, type* p_value); \
+				linkage struct_name function_name_prefix##push_pop(mumaResult* result, struct_name s, type value, type* p_value); \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s);
+
+			#define mu_dary_heap_definitions(struct_name, type, function_name_prefix, less_func, arity, linkage) \
+				\
+				/* Moves value up from the hole at index i */ \
+				static void function_name_prefix##inner_sift_up(type* data, size_m i, type value) { \
+					while (i > 0) { \
+						size_m parent = (i-1)/(arity); \
+						if (!less_func(value, data[parent])) { \
+							break; \
+						} \
+						data[i] = data[parent]; \
+						i = parent; \
+					} \
+					data[i] = value; \
+				} \
+				\
+				/* Moves value down from the hole at index i */ \
+				static void function_name_prefix##inner_sift_down(type* data, size_m length, size_m i, type value) { \
+					for (;;) { \
+						size_m first = i*(arity) + 1; \
+						if (first >= length) { \
+							break; \
+						} \
+						size_m last = (length-first < (arity)) ? length : first+(arity); \
+						size_m child = first; \
+						for (size_m c = first+1; c < last; c++) { \
+							if (less_func(data[c], data[child])) { \
+								child = c; \
+							} \
+						} \
+						if (!less_func(data[child], value)) { \
+							break; \
+						} \
+						data[i] = data[child]; \
+						i = child; \
+					} \
+					data[i] = value; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty heap, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `allocated_length` is the amount of elements that the heap has room for before it needs to grow. Note that `allocated_length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.data = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					\
+					if (allocated_length == 0) { \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s.data = (type*)muma_malloc(&res, sizeof(type)*allocated_length); \
+					if (s.data == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					s.allocated_length = allocated_length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation from elements @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create_from` is used to create a heap holding a copy of a list of elements, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create_from(mumaResult* result, type* data, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The elements are copied and then heapified in O(n), which is faster than pushing them one by one. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create_from(mumaResult* result, type* data, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					struct_name s = function_name_prefix##create(&res, count); \
+					if (res != MUMA_SUCCESS || count == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					mu_memcpy(s.data, data, sizeof(type)*count); \
+					s.length = count; \
+					if (count < 2) { \
+						return s; \
+					} \
+					for (size_m i = (count-2)/(arity) + 1; i > 0; i--) { \
+						function_name_prefix##inner_sift_down(s.data, count, i-1, s.data[i-1]); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a heap and free its contents, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.data != MU_NULL_PTR) { \
+						muma_free(s.data, sizeof(type)*s.allocated_length); \
+						s.data = MU_NULL_PTR; \
+					} \
+					\
+					s.allocated_length = 0; \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Heapify @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##heapify` is used to rearrange the elements of a heap into heap order, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##heapify(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function runs in O(n), and is meant to be used after the elements of `s.data` have been filled in some other way (such as by moving a dynamic array's members into the heap). @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##heapify(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length < 2) { \
+						return s; \
+					} \
+					for (size_m i = (s.length-2)/(arity) + 1; i > 0; i--) { \
+						function_name_prefix##inner_sift_down(s.data, s.length, i-1, s.data[i-1]); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Top @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##top` is used to get the top element of a heap, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN type* function_name_prefix##top(struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the heap is empty, 0 is returned. Note that the top element must not be modified through the returned pointer in a way that changes its order. @NEWLINE @DOCEND */ \
+				linkage type* function_name_prefix##top(struct_name s) { \
+					return (s.length == 0) ? MU_NULL_PTR : &s.data[0]; \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element onto a heap, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length == s.allocated_length) { \
+						size_m allocated_length = (s.allocated_length == 0) ? 1 : s.allocated_length*2; \
+						mumaResult res = MUMA_SUCCESS; \
+						type* new_data = (type*)muma_realloc(&res, s.data, sizeof(type)*s.allocated_length, sizeof(type)*allocated_length); \
+						if (new_data == 0) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						s.data = new_data; \
+						s.allocated_length = allocated_length; \
+					} \
+					\
+					function_name_prefix##inner_sift_up(s.data, s.length, value); \
+					s.length++; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop the top element off of a heap, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##pop(mumaResult* result, struct_name s, type* p_value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If successful and `p_value` isn't 0, `p_value` is dereferenced and set to the popped element. If the heap is empty, `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s, type* p_value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length == 0) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					if (p_value != MU_NULL_PTR) { \
+						*p_value = s.data[0]; \
+					} \
+					s.length--; \
+					if (s.length != 0) { \
+						function_name_prefix##inner_sift_down(s.data, s.length, 0, s.data[s.length]); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Push-pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push_pop` is used to push an element onto a heap and then pop the top element off of it, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push_pop(mumaResult* result, struct_name s, type value, type* p_value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `p_value` isn't 0, `p_value` is dereferenced and set to the popped element. This gives the same result as `function_name_prefix##push` followed by `function_name_prefix##pop`, but never allocates and only sifts once: if `value` would be the new top, it is given back right away without touching the heap. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push_pop(mumaResult* result, struct_name s, type value, type* p_value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length == 0 || !less_func(s.data[0], value)) { \
+						if (p_value != MU_NULL_PTR) { \
+							*p_value = value; \
+						} \
+						return s; \
+					} \
+					\
+					if (p_value != MU_NULL_PTR) { \
+						*p_value = s.data[0]; \
+					} \
+					function_name_prefix##inner_sift_down(s.data, s.length, 0, value); \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##clear` is used to remove every element from a heap without freeing its memory, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##clear(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					s.length = 0; \
+					return s; \
+				}
+
+			#define mu_dary_heap_declaration(struct_name, type, function_name_prefix, less_func, arity) \
+				mu_dary_heap_struct(struct_name, type) \
+				mu_dary_heap_definitions(struct_name, type, function_name_prefix, less_func, arity, )
+
+			#define mu_dary_heap_header(struct_name, type, function_name_prefix, less_func, arity) \
+				mu_dary_heap_struct(struct_name, type) \
+				mu_dary_heap_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_dary_heap_impl(struct_name, type, function_name_prefix, less_func, arity) \
+				mu_dary_heap_definitions(struct_name, type, function_name_prefix, less_func, arity, )
+
+			#define mu_dary_heap_static_declaration(struct_name, type, function_name_prefix, less_func, arity) \
+				mu_dary_heap_struct(struct_name, type) \
+				mu_dary_heap_definitions(struct_name, type, function_name_prefix, less_func, arity, static MUMA_INLINE)
+
+		// @DOCLINE ## Hash map
+
+			/* @DOCBEGIN
+
+			The macro `mu_hash_map_declaration` is a macro function that is used to create a hash map, which maps keys to values with O(1) average lookups, insertions, and erasures. Its parameters look like this:
+
+			```c
+			mu_hash_map_declaration(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func)
+			```
+
+			`struct_name` is the desired name of the hash map struct that will be created.
+
+			`key_type` and `value_type` are the types of the keys and values of the hash map.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			`hash_func` is the name of a function or macro function that takes in a parameter of type `key_type` and returns a hash of it as an integer. The hash is mixed internally before it's used, so cheap hashes (such as the value of an integer key itself) work fine.
+
+			`eq_func` is the name of a function or macro function that takes in two parameters of type `key_type` and returns whether or not they are equal. Keys that are equal must have the same hash.
+
+			### Layout
+
+			The hash map uses open addressing with linear probing. Each slot has a control byte, which is either empty or holds 7 bits of the hash of the key in the slot. Lookups compare the control bytes of 16 slots at a time (using SSE2 when `MUMA_SSE2` is defined, and a scalar loop otherwise), only comparing keys for slots whose control byte matches, and stop at the first empty slot.
+
+			Erasing an element shifts the elements after it backwards instead of leaving a tombstone, so lookups never get slower over time from erasures, and the hash map never needs to be rehashed to clean them up.
+
+			The hash map keeps its capacity a power of 2 that is at least 16, and grows (doubling) before more than 7/8ths of its slots are full.
+
+			### Struct
+
+			The hash map expands to do a few things. The first thing it does is create a struct for the entries of the hash map and for the hash map itself, following this expansion:
+
+			```c
+			struct struct_name##_entry {
+				key_type key;
+				value_type value;
+			}; typedef struct struct_name##_entry struct_name##_entry;
+
+			struct struct_name {
+				struct_name##_entry* entries;
+				muByte* ctrl;
+				size_m capacity;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`entries` holds the `capacity` slots of the hash map, of which `length` are in use, and `ctrl` holds the control byte of each slot (plus a copy of the first 16 at the end, so that 16 control bytes can always be read at once). Both are stored in a single allocation.
+
+			Note that these members aren't meant to be modified by the user, only read. The entries of a hash map can be iterated over by going through every slot index below `capacity` and skipping the ones for which `function_name_prefix##is_occupied` returns false.
+
+			Note that pointers to values returned by a hash map are invalidated by any call that inserts into or erases from the hash map.
+
+			### Linkage
+
+			`mu_hash_map_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. A map that is shared between files can instead use `mu_hash_map_header` in a header and `mu_hash_map_impl` in exactly one source file, and a map that is only used in one file (or whose lookups should be inlined into their callers) can use `mu_hash_map_static_declaration`, which defines every function as `static inline`. All three take the same parameters as `mu_hash_map_declaration` and behave like their dynamic array counterparts:
+
+			```c
+			mu_hash_map_header(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func)
+			mu_hash_map_impl(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func)
+			mu_hash_map_static_declaration(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func)
+			```
+
+			They are built on `mu_hash_map_struct(struct_name, key_type, value_type)`, `mu_hash_map_prototypes(struct_name, key_type, value_type, function_name_prefix, linkage)`, and `mu_hash_map_definitions(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			// Amount of slots whose control bytes are compared at once
+			#define MUMA_HASH_MAP_GROUP 16
+			// Control byte of an empty slot; full slots have the high bit clear
+			#define MUMA_HASH_MAP_EMPTY 0x80
+
+			// Size of a hash map's allocation for the given capacity
+			#define muma_hash_map_size(entry_size, capacity) ((entry_size)*(capacity) + (capacity) + MUMA_HASH_MAP_GROUP)
+
+			// Spreads the bits of a user-provided hash across all 64 bits
+			static MUMA_INLINE uint64_m muma_hash_map_mix(uint64_m h) {
+				h *= 0x9E3779B97F4A7C15ULL;
+				return h ^ (h >> 32);
+			}
+
+			// Bitmasks of which of the 16 control bytes at `ctrl` equal
+			// `h2`, and which are empty
+			#ifdef MUMA_SSE2
+
+				static MUMA_INLINE uint32_m muma_hash_map_match(const muByte* ctrl, muByte h2) {
+					__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+					return (uint32_m)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+				}
+
+				static MUMA_INLINE uint32_m muma_hash_map_match_empty(const muByte* ctrl) {
+					return (uint32_m)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+				}
+
+			#else
+
+				static MUMA_INLINE uint32_m muma_hash_map_match(const muByte* ctrl, muByte h2) {
+					uint32_m mask = 0;
+					for (uint32_m i = 0; i < MUMA_HASH_MAP_GROUP; i++) {
+						mask |= (uint32_m)(ctrl[i] == h2) << i;
+					}
+					return mask;
+				}
+
+				static MUMA_INLINE uint32_m muma_hash_map_match_empty(const muByte* ctrl) {
+					uint32_m mask = 0;
+					for (uint32_m i = 0; i < MUMA_HASH_MAP_GROUP; i++) {
+						mask |= (uint32_m)(ctrl[i] >> 7) << i;
+					}
+					return mask;
+				}
+
+			#endif
+
+			// Capacity needed to hold `length` elements
+			static MUMA_INLINE size_m muma_hash_map_capacity(size_m length) {
+				size_m capacity = MUMA_HASH_MAP_GROUP;
+				while (length > capacity - capacity/8) {
+					capacity *= 2;
+				}
+				return capacity;
+			}
+
+			#define mu_hash_map_struct(struct_name, key_type, value_type) \
+				\
+				struct struct_name##_entry { \
+					key_type key; \
+					value_type value; \
+				}; typedef struct struct_name##_entry struct_name##_entry; \
+				\
+				struct struct_name { \
+					struct_name##_entry* entries; \
+					muByte* ctrl; \
+					size_m capacity; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_hash_map_prototypes(struct_name, key_type, value_type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m length); \
+				linkage value_type* function_name_prefix##find(struct_name s, key_type key); \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, key_type key, value_type value); \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, key_type key); \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s); \
+				linkage muBool function_name_prefix##is_occupied(struct_name s, size_m index);
+
+			#define mu_hash_map_definitions(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func, linkage) \
+				\
+				static MUMA_INLINE uint64_m function_name_prefix##inner_hash(key_type key) { \
+					return muma_hash_map_mix((uint64_m)hash_func(key)); \
+				} \
+				\
+				/* Sets a control byte, keeping the copy of the first group in sync */ \
+				static MUMA_INLINE void function_name_prefix##inner_set_ctrl(struct_name s, size_m i, muByte c) { \
+					s.ctrl[i] = c; \
+					if (i < MUMA_HASH_MAP_GROUP) { \
+						s.ctrl[s.capacity + i] = c; \
+					} \
+				} \
+				\
+				/* Returns the slot holding key, or MU_SIZE_MAX if there isn't one, */ \
+				/* in which case p_empty is set to the slot where it would go */ \
+				static MUMA_INLINE size_m function_name_prefix##inner_find(struct_name s, key_type key, uint64_m h, size_m* p_empty) { \
+					size_m mask = s.capacity - 1; \
+					muByte h2 = (muByte)(h & 0x7F); \
+					size_m pos = (size_m)(h >> 7) & mask; \
+					for (;;) { \
+						uint32_m match = muma_hash_map_match(&s.ctrl[pos], h2); \
+						uint32_m empty = muma_hash_map_match_empty(&s.ctrl[pos]); \
+						if (empty != 0) { \
+							match &= (empty & (~empty + 1)) - 1; \
+						} \
+						while (match != 0) { \
+							size_m i = (pos + MUMA_CTZ64(match)) & mask; \
+							if (eq_func(s.entries[i].key, key)) { \
+								return i; \
+							} \
+							match &= match - 1; \
+						} \
+						if (empty != 0) { \
+							if (p_empty != MU_NULL_PTR) { \
+								*p_empty = (pos + MUMA_CTZ64(empty)) & mask; \
+							} \
+							return MU_SIZE_MAX; \
+						} \
+						pos = (pos + MUMA_HASH_MAP_GROUP) & mask; \
+					} \
+				} \
+				\
+				/* Moves every element into a new allocation with the given capacity */ \
+				static struct_name function_name_prefix##inner_rehash(mumaResult* result, struct_name s, size_m capacity) { \
+					mumaResult res = MUMA_SUCCESS; \
+					muByte* allocation = (muByte*)muma_malloc(&res, muma_hash_map_size(sizeof(struct_name##_entry), capacity)); \
+					if (allocation == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					struct_name n = s; \
+					n.entries = (struct_name##_entry*)allocation; \
+					n.ctrl = allocation + sizeof(struct_name##_entry)*capacity; \
+					n.capacity = capacity; \
+					mu_memset(n.ctrl, MUMA_HASH_MAP_EMPTY, capacity + MUMA_HASH_MAP_GROUP); \
+					\
+					for (size_m i = 0; i < s.capacity; i++) { \
+						if (s.ctrl[i] & MUMA_HASH_MAP_EMPTY) { \
+							continue; \
+						} \
+						size_m j = (size_m)(function_name_prefix##inner_hash(s.entries[i].key) >> 7) & (capacity - 1); \
+						while ((n.ctrl[j] & MUMA_HASH_MAP_EMPTY) == 0) { \
+							j = (j + 1) & (capacity - 1); \
+						} \
+						n.entries[j] = s.entries[i]; \
+						function_name_prefix##inner_set_ctrl(n, j, s.ctrl[i]); \
+					} \
+					\
+					if (s.entries != MU_NULL_PTR) { \
+						muma_free(s.entries, muma_hash_map_size(sizeof(struct_name##_entry), s.capacity)); \
+					} \
+					return n; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty hash map, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `length` is the amount of elements that the hash map has room for before it needs to grow. Note that `length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.entries = MU_NULL_PTR; \
+					s.ctrl = MU_NULL_PTR; \
+					s.capacity = 0; \
+					s.length = 0; \
+					\
+					if (length == 0) { \
+						return s; \
+					} \
+					return function_name_prefix##inner_rehash(result, s, muma_hash_map_capacity(length)); \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a hash map and free its contents, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.entries != MU_NULL_PTR) { \
+						muma_free(s.entries, muma_hash_map_size(sizeof(struct_name##_entry), s.capacity)); \
+					} \
+					\
+					s.entries = MU_NULL_PTR; \
+					s.ctrl = MU_NULL_PTR; \
+					s.capacity = 0; \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Reserve @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##reserve` is used to make sure that a hash map can hold a given amount of elements without growing, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the hash map needs to grow, every element is rehashed once; reserving ahead of a known amount of insertions avoids rehashing repeatedly while inserting. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m capacity = muma_hash_map_capacity(length); \
+					if (capacity <= s.capacity) { \
+						return s; \
+					} \
+					return function_name_prefix##inner_rehash(result, s, capacity); \
+				} \
+				\
+				/*@DOCBEGIN #### Find @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find` is used to find the value of a key in a hash map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN value_type* function_name_prefix##find(struct_name s, key_type key) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the key isn't in the hash map, 0 is returned. @NEWLINE @DOCEND */ \
+				linkage value_type* function_name_prefix##find(struct_name s, key_type key) { \
+					if (s.length == 0) { \
+						return MU_NULL_PTR; \
+					} \
+					size_m i = function_name_prefix##inner_find(s, key, function_name_prefix##inner_hash(key), MU_NULL_PTR); \
+					return (i == MU_SIZE_MAX) ? MU_NULL_PTR : &s.entries[i].value; \
+				} \
+				\
+				/*@DOCBEGIN #### Set @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##set` is used to set the value of a key in a hash map, inserting the key if it isn't already in it, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##set(mumaResult* result, struct_name s, key_type key, value_type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, key_type key, value_type value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					uint64_m h = function_name_prefix##inner_hash(key); \
+					size_m empty = 0; \
+					if (s.capacity != 0) { \
+						size_m i = function_name_prefix##inner_find(s, key, h, &empty); \
+						if (i != MU_SIZE_MAX) { \
+							s.entries[i].value = value; \
+							return s; \
+						} \
+					} \
+					\
+					if (s.length + 1 > s.capacity - s.capacity/8) { \
+						mumaResult res = MUMA_SUCCESS; \
+						s = function_name_prefix##inner_rehash(&res, s, (s.capacity == 0) ? MUMA_HASH_MAP_GROUP : s.capacity*2); \
+						if (res != MUMA_SUCCESS) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						function_name_prefix##inner_find(s, key, h, &empty); \
+					} \
+					\
+					s.entries[empty].key = key; \
+					s.entries[empty].value = value; \
+					function_name_prefix##inner_set_ctrl(s, empty, (muByte)(h & 0x7F)); \
+					s.length++; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##erase` is used to erase a key (and its value) from a hash map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##erase(mumaResult* result, struct_name s, key_type key) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the key isn't in the hash map, `MUMA_NOT_FOUND` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, key_type key) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m i = (s.length == 0) ? MU_SIZE_MAX : function_name_prefix##inner_find(s, key, function_name_prefix##inner_hash(key), MU_NULL_PTR); \
+					if (i == MU_SIZE_MAX) { \
+						MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+						return s; \
+					} \
+					\
+					/* Shift back every following element that is allowed to move into the hole */ \
+					size_m mask = s.capacity - 1; \
+					for (size_m j = (i + 1) & mask; (s.ctrl[j] & MUMA_HASH_MAP_EMPTY) == 0; j = (j + 1) & mask) { \
+						size_m home = (size_m)(function_name_prefix##inner_hash(s.entries[j].key) >> 7) & mask; \
+						if (((j - home) & mask) >= ((j - i) & mask)) { \
+							s.entries[i] = s.entries[j]; \
+							function_name_prefix##inner_set_ctrl(s, i, s.ctrl[j]); \
+							i = j; \
+						} \
+					} \
+					function_name_prefix##inner_set_ctrl(s, i, MUMA_HASH_MAP_EMPTY); \
+					s.length--; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##clear` is used to erase every element from a hash map without freeing its memory, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##clear(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.ctrl != MU_NULL_PTR) { \
+						mu_memset(s.ctrl, MUMA_HASH_MAP_EMPTY, s.capacity + MUMA_HASH_MAP_GROUP); \
+					} \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Is occupied @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##is_occupied` is used to check whether or not a slot of a hash map holds an element, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##is_occupied(struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If it does, the element is `s.entries[index]`. @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##is_occupied(struct_name s, size_m index) { \
+					return index < s.capacity && (s.ctrl[index] & MUMA_HASH_MAP_EMPTY) == 0; \
+				}
+
+			#define mu_hash_map_declaration(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func) \
+				mu_hash_map_struct(struct_name, key_type, value_type) \
+				mu_hash_map_definitions(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func, )
+
+			#define mu_hash_map_header(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func) \
+				mu_hash_map_struct(struct_name, key_type, value_type) \
+				mu_hash_map_prototypes(struct_name, key_type, value_type, function_name_prefix, )
+
+			#define mu_hash_map_impl(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func) \
+				mu_hash_map_definitions(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func, )
+
+			#define mu_hash_map_static_declaration(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func) \
+				mu_hash_map_struct(struct_name, key_type, value_type) \
+				mu_hash_map_definitions(struct_name, key_type, value_type, function_name_prefix, hash_func, eq_func, static MUMA_INLINE)
+
+		// @DOCLINE ## Slot map
+
+			/* @DOCBEGIN
+
+			The macro `mu_slot_map_declaration` is a macro function that is used to create a slot map, which is a container that stores elements densely packed in memory (allowing for cache-friendly iteration), while handing out stable handles to them that stay valid no matter what other elements are inserted or removed. Inserting, removing, and looking up an element by its handle are all O(1). Its parameters look like this:
+
+			```c
+			mu_slot_map_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the slot map struct that will be created for the given type.
+
+			`type` is the type that will be used to represent an element in the slot map.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Handles
+
+			An element in a slot map is referred to by a handle, represented by the struct `mumaSlotHandle`, which is defined as so:
+
+			```c
+			struct mumaSlotHandle {
+				uint32_m index;
+				uint32_m generation;
+			}; typedef struct mumaSlotHandle mumaSlotHandle;
+			```
+
+			`index` is the index of the slot that the handle refers to, and `generation` is the generation of that slot at the time the handle was given out. When an element is removed, its slot's generation changes and the slot gets reused for a later insertion, so every handle to the removed element becomes invalid instead of silently referring to a different element.
+
+			Note that a handle with a generation of 0 is never valid, so a zeroed-out handle can be used as a null handle.
+
+			### Struct
+
+			The slot map expands to do a few things. The first thing it does is create a struct for the slot map, following this expansion:
+
+			```c
+			struct struct_name {
+				type* data;
+				mumaSlotMapSlot* slots;
+				uint32_m* data_slots;
+				size_m allocated_length;
+				size_m length;
+				size_m slot_count;
+				uint32_m free_slot;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`data` holds the `length` elements currently stored in the slot map, densely packed, meaning that the elements can be iterated over like a regular array. Note that the order of the elements changes when an element is removed (the last element is moved into the removed element's place).
+
+			`data_slots[i]` is the index of the slot that `data[i]` belongs to, and `slots` is the array of all `slot_count` slots ever used. `free_slot` is the first slot in the list of slots available for reuse.
+
+			Note that these members aren't meant to be modified by the user, only read.
+
+			Note that all of a slot map's memory is stored in a single allocation, which is only ever grown (doubling in size), never shrunk, until the slot map is destroyed.
+
+			### Linkage
+
+			Like `mu_dynamic_array_declaration`, `mu_slot_map_declaration` defines its functions with external linkage and can therefore only be expanded in one translation unit. The same split described in the dynamic array's linkage section is available with the same parameters:
+
+			```c
+			mu_slot_map_header(struct_name, type, function_name_prefix)
+			mu_slot_map_impl(struct_name, type, function_name_prefix)
+			mu_slot_map_static_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`mu_slot_map_header` defines the struct and declares the functions, `mu_slot_map_impl` defines them (in one translation unit), and `mu_slot_map_static_declaration` defines everything as `static inline`. They are built on `mu_slot_map_struct(struct_name, type)`, `mu_slot_map_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_slot_map_definitions(struct_name, type, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			struct mumaSlotHandle {
+				uint32_m index;
+				uint32_m generation;
+			}; typedef struct mumaSlotHandle mumaSlotHandle;
+
+			// Internal slot of a slot map; `index` is the element's index
+			// in `data` if the slot is used, and the next free slot if not.
+			struct mumaSlotMapSlot {
+				uint32_m index;
+				uint32_m generation;
+			}; typedef struct mumaSlotMapSlot mumaSlotMapSlot;
+
+			// Marks the end of a slot map's free slot list
+			#define MUMA_SLOT_MAP_NO_SLOT ((uint32_m)0xFFFFFFFF)
+
+			// Offsets and total size of a slot map's allocation for the
+			// given capacity; the slots start 8-byte aligned after the data.
+			#define muma_slot_map_slots_offset(type_size, capacity) ((((type_size)*(capacity))+7) & ~(size_m)7)
+			#define muma_slot_map_data_slots_offset(type_size, capacity) (muma_slot_map_slots_offset(type_size, capacity) + sizeof(mumaSlotMapSlot)*(capacity))
+			#define muma_slot_map_size(type_size, capacity) (muma_slot_map_data_slots_offset(type_size, capacity) + sizeof(uint32_m)*(capacity))
+
+			#define mu_slot_map_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					type* data; \
+					mumaSlotMapSlot* slots; \
+					uint32_m* data_slots; \
+					size_m allocated_length; \
+					size_m length; \
+					size_m slot_count; \
+					uint32_m free_slot; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_slot_map_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m allocated_length); \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage muBool function_name_prefix##contains(struct_name s, mumaSlotHandle handle); \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type insert, mumaSlotHandle* p_handle); \
+				linkage struct_name function_name_prefix##remove(mumaResult* result, struct_name s, mumaSlotHandle handle); \
+				linkage type* function_name_prefix##get(mumaResult* result, struct_name s, mumaSlotHandle handle); \
+				linkage mumaSlotHandle function_name_prefix##get_handle(mumaResult* result, struct_name s, size_m index); \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s);
+
+			#define mu_slot_map_definitions(struct_name, type, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Reserve @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##reserve` is used to make sure that a slot map has room for at least a certain amount of elements, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `allocated_length` is above `s.allocated_length`, the slot map is moved to a new allocation that can hold exactly `allocated_length` elements. Note that a slot map can't hold more than `0xFFFFFFFE` elements, so `MUMA_FAILED_TO_ALLOCATE` is returned if `allocated_length` is above that; growth from `function_name_prefix##insert` stops at exactly that many elements. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##reserve(mumaResult* result, struct_name s, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (allocated_length <= s.allocated_length) { \
+						return s; \
+					} \
+					if (allocated_length > (size_m)MUMA_SLOT_MAP_NO_SLOT-1) { \
+						MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE) \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					muByte* block = (muByte*)muma_malloc(&res, muma_slot_map_size(sizeof(type), allocated_length)); \
+					if (block == MU_NULL_PTR) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					type* data = (type*)block; \
+					mumaSlotMapSlot* slots = (mumaSlotMapSlot*)&block[muma_slot_map_slots_offset(sizeof(type), allocated_length)]; \
+					uint32_m* data_slots = (uint32_m*)&block[muma_slot_map_data_slots_offset(sizeof(type), allocated_length)]; \
+					\
+					if (s.data != MU_NULL_PTR) { \
+						mu_memcpy(data, s.data, sizeof(type)*s.length); \
+						mu_memcpy(slots, s.slots, sizeof(mumaSlotMapSlot)*s.slot_count); \
+						mu_memcpy(data_slots, s.data_slots, sizeof(uint32_m)*s.length); \
+						muma_free(s.data, muma_slot_map_size(sizeof(type), s.allocated_length)); \
+					} \
+					\
+					s.data = data; \
+					s.slots = slots; \
+					s.data_slots = data_slots; \
+					s.allocated_length = allocated_length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create a slot map, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The created slot map holds no elements, but has room for `allocated_length` elements. Note that `allocated_length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) { \
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.data = MU_NULL_PTR; \
+					s.slots = MU_NULL_PTR; \
+					s.data_slots = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					s.slot_count = 0; \
+					s.free_slot = MUMA_SLOT_MAP_NO_SLOT; \
+					return function_name_prefix##reserve(result, s, allocated_length); \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a slot map and fully free its contents, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that this function is safe to call on a slot map with nothing allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.data != MU_NULL_PTR) { \
+						muma_free(s.data, muma_slot_map_size(sizeof(type), s.allocated_length)); \
+					} \
+					\
+					return function_name_prefix##create(MU_NULL_PTR, 0); \
+				} \
+				\
+				/*@DOCBEGIN #### Contains @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##contains` is used to check if a handle refers to an element currently in a slot map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##contains(struct_name s, mumaSlotHandle handle) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##contains(struct_name s, mumaSlotHandle handle) { \
+					return handle.generation != 0 && handle.index < s.slot_count && s.slots[handle.index].generation == handle.generation; \
+				} \
+				\
+				/*@DOCBEGIN #### Insert @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##insert` is used to insert an element into a slot map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type insert, mumaSlotHandle* p_handle) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The element is placed at the end of `s.data`, reusing a previously freed slot if one is available. If successful and `p_handle` isn't 0, `p_handle` is dereferenced and set to the handle of the inserted element; if not successful, it is set to a null handle. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type insert, mumaSlotHandle* p_handle) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (p_handle != MU_NULL_PTR) { \
+						p_handle->index = 0; \
+						p_handle->generation = 0; \
+					} \
+					\
+					if (s.length == s.allocated_length) { \
+						/* Growth is clamped to the most elements that handles */ \
+						/* can index, so only inserting past that fails */ \
+						size_m max_length = (size_m)MUMA_SLOT_MAP_NO_SLOT-1; \
+						if (s.allocated_length >= max_length) { \
+							MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE) \
+							return s; \
+						} \
+						size_m new_length = (s.allocated_length == 0) ? 1 : s.allocated_length*2; \
+						if (s.allocated_length > max_length/2) { \
+							new_length = max_length; \
+						} \
+						mumaResult res = MUMA_SUCCESS; \
+						s = function_name_prefix##reserve(&res, s, new_length); \
+						if (res != MUMA_SUCCESS) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+					} \
+					\
+					uint32_m slot; \
+					if (s.free_slot != MUMA_SLOT_MAP_NO_SLOT) { \
+						slot = s.free_slot; \
+						s.free_slot = s.slots[slot].index; \
+					} else { \
+						slot = (uint32_m)s.slot_count; \
+						s.slot_count++; \
+						s.slots[slot].generation = 1; \
+					} \
+					\
+					s.slots[slot].index = (uint32_m)s.length; \
+					s.data[s.length] = insert; \
+					s.data_slots[s.length] = slot; \
+					s.length++; \
+					\
+					if (p_handle != MU_NULL_PTR) { \
+						p_handle->index = slot; \
+						p_handle->generation = s.slots[slot].generation; \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Remove @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##remove` is used to remove an element from a slot map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##remove(mumaResult* result, struct_name s, mumaSlotHandle handle) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The last element of `s.data` is moved into the removed element's place, and the removed element's slot is freed for reuse, invalidating every handle to it. If `handle` doesn't refer to an element in the slot map, `MUMA_INVALID_HANDLE` is returned. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##remove(mumaResult* result, struct_name s, mumaSlotHandle handle) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (!function_name_prefix##contains(s, handle)) { \
+						MU_SET_RESULT(result, MUMA_INVALID_HANDLE) \
+						return s; \
+					} \
+					\
+					uint32_m index = s.slots[handle.index].index; \
+					uint32_m last = (uint32_m)(s.length-1); \
+					if (index != last) { \
+						s.data[index] = s.data[last]; \
+						s.data_slots[index] = s.data_slots[last]; \
+						s.slots[s.data_slots[index]].index = index; \
+					} \
+					s.length--; \
+					\
+					s.slots[handle.index].generation++; \
+					if (s.slots[handle.index].generation == 0) { \
+						s.slots[handle.index].generation = 1; \
+					} \
+					s.slots[handle.index].index = s.free_slot; \
+					s.free_slot = handle.index; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Get @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##get` is used to get a pointer to the element that a handle refers to, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN type* function_name_prefix##get(mumaResult* result, struct_name s, mumaSlotHandle handle) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `handle` doesn't refer to an element in the slot map, 0 is returned and `MUMA_INVALID_HANDLE` is the result. Note that the returned pointer is only valid until the slot map is next modified. @NEWLINE @DOCEND */ \
+				linkage type* function_name_prefix##get(mumaResult* result, struct_name s, mumaSlotHandle handle) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (!function_name_prefix##contains(s, handle)) { \
+						MU_SET_RESULT(result, MUMA_INVALID_HANDLE) \
+						return MU_NULL_PTR; \
+					} \
+					\
+					return &s.data[s.slots[handle.index].index]; \
+				} \
+				\
+				/*@DOCBEGIN #### Get handle @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##get_handle` is used to get the handle of the element at a given index in `s.data`, which is useful while iterating over a slot map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN mumaSlotHandle function_name_prefix##get_handle(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `index` is out of range, a null handle is returned and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage mumaSlotHandle function_name_prefix##get_handle(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaSlotHandle handle; \
+					handle.index = 0; \
+					handle.generation = 0; \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return handle; \
+					} \
+					\
+					handle.index = s.data_slots[index]; \
+					handle.generation = s.slots[handle.index].generation; \
+					return handle; \
+				} \
+				\
+				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##clear` is used to remove all of the elements from a slot map, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##clear(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Every handle given out by the slot map becomes invalid, but unlike `function_name_prefix##destroy`, the slot map's memory is kept for reuse. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##clear(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					for (size_m i = 0; i < s.length; i++) { \
+						uint32_m slot = s.data_slots[i]; \
+						s.slots[slot].generation++; \
+						if (s.slots[slot].generation == 0) { \
+							s.slots[slot].generation = 1; \
+						} \
+						s.slots[slot].index = s.free_slot; \
+						s.free_slot = slot; \
+					} \
+					\
+					s.length = 0; \
+					return s; \
+				}
+
+			#define mu_slot_map_declaration(struct_name, type, function_name_prefix) \
+				mu_slot_map_struct(struct_name, type) \
+				mu_slot_map_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_slot_map_header(struct_name, type, function_name_prefix) \
+				mu_slot_map_struct(struct_name, type) \
+				mu_slot_map_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_slot_map_impl(struct_name, type, function_name_prefix) \
+				mu_slot_map_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_slot_map_static_declaration(struct_name, type, function_name_prefix) \
+				mu_slot_map_struct(struct_name, type) \
+				mu_slot_map_definitions(struct_name, type, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Sparse set
+
+			/* @DOCBEGIN
+
+			The macro `mu_sparse_set_declaration` is a macro function that is used to create a sparse set, which is a set of integer IDs within a bounded universe (0 up to, but not including, a given universe size). Inserting, erasing, and checking whether or not an ID is in the set are all O(1), clearing the set is O(1), and the IDs in the set are stored contiguously, so iterating over them only touches the IDs that are actually in the set. Its parameters look like this:
+
+			```c
+			mu_sparse_set_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the sparse set struct that will be created for the given type.
+
+			`type` is the unsigned integer type that will be used to represent an ID (for example, `uint32_m`), which must be able to hold every ID below the universe size.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Struct
+
+			The sparse set expands to do a few things. The first thing it does is create a struct for the sparse set, following this expansion:
+
+			```c
+			struct struct_name {
+				type* dense;
+				type* sparse;
+				size_m universe;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`dense` holds the `length` IDs currently in the set, packed together, meaning that they can be iterated over like a regular array. Note that the order of the IDs changes when an ID is erased (the last ID is moved into the erased ID's place).
+
+			`sparse[id]` is the index of `id` in `dense` if `id` is in the set; an ID is only in the set if `sparse[id] < length` and `dense[sparse[id]] == id`, which is why clearing the set only needs to set `length` to 0.
+
+			Note that these members aren't meant to be modified by the user, only read.
+
+			Note that `dense` and `sparse` are stored in a single allocation, which holds `universe` IDs for each of them.
+
+			### Linkage
+
+			The functions defined by `mu_sparse_set_declaration` have external linkage, so the macro can only be expanded in one translation unit. As with dynamic arrays (see the dynamic array's linkage section), a sparse set can be split between a header and one source file, or defined as `static inline` wherever it's used, with these macros that take the same parameters:
+
+			```c
+			mu_sparse_set_header(struct_name, type, function_name_prefix)
+			mu_sparse_set_impl(struct_name, type, function_name_prefix)
+			mu_sparse_set_static_declaration(struct_name, type, function_name_prefix)
+			```
+
+			Inlining matters most here for `function_name_prefix##contains`, which is only a couple of loads. The macros are built on `mu_sparse_set_struct(struct_name, type)`, `mu_sparse_set_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_sparse_set_definitions(struct_name, type, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			#define mu_sparse_set_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					type* dense; \
+					type* sparse; \
+					size_m universe; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_sparse_set_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m universe); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##set_universe(mumaResult* result, struct_name s, size_m universe); \
+				linkage muBool function_name_prefix##contains(struct_name s, type id); \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type id); \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, type id); \
+				linkage struct_name function_name_prefix##clear(struct_name s);
+
+			#define mu_sparse_set_definitions(struct_name, type, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty sparse set, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m universe) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The created set can hold IDs from 0 up to (but not including) `universe`. `sparse` is zeroed out once here, so that no uninitialized memory is ever read; clearing the set later doesn't touch it again. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m universe) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.dense = MU_NULL_PTR; \
+					s.sparse = MU_NULL_PTR; \
+					s.universe = 0; \
+					s.length = 0; \
+					\
+					if (universe == 0) { \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s.dense = (type*)muma_malloc(&res, sizeof(type)*universe*2); \
+					if (s.dense == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					s.sparse = &s.dense[universe]; \
+					s.universe = universe; \
+					mu_memset(s.sparse, 0, sizeof(type)*universe); \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a sparse set, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.dense != MU_NULL_PTR) { \
+						muma_free(s.dense, sizeof(type)*s.universe*2); \
+					} \
+					\
+					s.dense = MU_NULL_PTR; \
+					s.sparse = MU_NULL_PTR; \
+					s.universe = 0; \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Set universe @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##set_universe` is used to grow the universe of a sparse set, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##set_universe(mumaResult* result, struct_name s, size_m universe) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `universe` is above `s.universe`, the set is moved to a new allocation that can hold IDs below `universe`, keeping the IDs currently in it; otherwise, nothing happens. This is O(`universe`). @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##set_universe(mumaResult* result, struct_name s, size_m universe) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (universe <= s.universe) { \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					struct_name n = function_name_prefix##create(&res, universe); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					if (s.length != 0) { \
+						mu_memcpy(n.dense, s.dense, sizeof(type)*s.length); \
+					} \
+					n.length = s.length; \
+					for (size_m i = 0; i < n.length; i++) { \
+						n.sparse[n.dense[i]] = (type)i; \
+					} \
+					\
+					function_name_prefix##destroy(MU_NULL_PTR, s); \
+					return n; \
+				} \
+				\
+				/*@DOCBEGIN #### Contains @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##contains` is used to check whether or not an ID is in a sparse set, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##contains(struct_name s, type id) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN IDs outside of the universe are never in the set. @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##contains(struct_name s, type id) { \
+					if ((size_m)id >= s.universe) { \
+						return MU_FALSE; \
+					} \
+					size_m index = (size_m)s.sparse[id]; \
+					return index < s.length && s.dense[index] == id; \
+				} \
+				\
+				/*@DOCBEGIN #### Insert @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##insert` is used to insert an ID into a sparse set, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type id) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The ID is added onto the end of `dense`. If `id` is outside of the universe, `MUMA_INVALID_INDEX` is the result; if it is already in the set, nothing happens. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, type id) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if ((size_m)id >= s.universe) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					if (function_name_prefix##contains(s, id)) { \
+						return s; \
+					} \
+					\
+					s.dense[s.length] = id; \
+					s.sparse[id] = (type)s.length; \
+					s.length++; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##erase` is used to erase an ID from a sparse set, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##erase(mumaResult* result, struct_name s, type id) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The last ID in `dense` is moved into the erased ID's place. If `id` isn't in the set, `MUMA_NOT_FOUND` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, type id) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (!function_name_prefix##contains(s, id)) { \
+						MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+						return s; \
+					} \
+					\
+					size_m index = (size_m)s.sparse[id]; \
+					type last = s.dense[s.length-1]; \
+					s.dense[index] = last; \
+					s.sparse[last] = (type)index; \
+					s.length--; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##clear` is used to erase every ID from a sparse set in O(1), defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##clear(struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##clear(struct_name s) { \
+					s.length = 0; \
+					return s; \
+				}
+
+			#define mu_sparse_set_declaration(struct_name, type, function_name_prefix) \
+				mu_sparse_set_struct(struct_name, type) \
+				mu_sparse_set_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_sparse_set_header(struct_name, type, function_name_prefix) \
+				mu_sparse_set_struct(struct_name, type) \
+				mu_sparse_set_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_sparse_set_impl(struct_name, type, function_name_prefix) \
+				mu_sparse_set_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_sparse_set_static_declaration(struct_name, type, function_name_prefix) \
+				mu_sparse_set_struct(struct_name, type) \
+				mu_sparse_set_definitions(struct_name, type, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Bit array
+
+			/* @DOCBEGIN
+
+			The macro `mu_bit_array_declaration` is a macro function that is used to create a bit array, which is a dynamic array of boolean values packed 64 to a word. Compared to a dynamic array of `muBool` (which takes at least a byte per value), it uses at least 8 times less memory, and counting or searching it is done a word at a time. Its parameters look like this:
+
+			```c
+			mu_bit_array_declaration(struct_name, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the bit array struct that will be created.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Struct
+
+			The bit array expands to do a few things. The first thing it does is create a struct for the bit array, following this expansion:
+
+			```c
+			struct struct_name {
+				uint64_m* data;
+				size_m allocated_length;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`length` is the amount of bits in the array, and `allocated_length` is the amount of bits that the allocated words can hold (which is always a multiple of 64). Bit `i` is stored in bit `i%64` of `data[i/64]`.
+
+			Note that every bit at or past index `length` in the allocated words is always 0, which the bit array functions rely on.
+
+			Note that these members aren't meant to be modified by the user, only read.
+
+			### Linkage
+
+			`mu_bit_array_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. For a bit array used across several files, `mu_bit_array_header` (the struct and the function prototypes) and `mu_bit_array_impl` (the function definitions, in one translation unit) can be used instead; `mu_bit_array_static_declaration` defines everything as `static inline`, which lets single-bit calls such as `function_name_prefix##test` inline down to a shift and a mask. They take the same parameters, and work the same way as described in the dynamic array's linkage section:
+
+			```c
+			mu_bit_array_header(struct_name, function_name_prefix)
+			mu_bit_array_impl(struct_name, function_name_prefix)
+			mu_bit_array_static_declaration(struct_name, function_name_prefix)
+			```
+
+			They are built on `mu_bit_array_struct(struct_name)`, `mu_bit_array_prototypes(struct_name, function_name_prefix, linkage)`, and `mu_bit_array_definitions(struct_name, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			#define mu_bit_array_struct(struct_name) \
+				\
+				struct struct_name { \
+					uint64_m* data; \
+					size_m allocated_length; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_bit_array_prototypes(struct_name, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length); \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, muBool value); \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, muBool value); \
+				linkage muBool function_name_prefix##test(mumaResult* result, struct_name s, size_m index); \
+				linkage size_m function_name_prefix##count(struct_name s); \
+				linkage size_m function_name_prefix##find_first_set(mumaResult* result, struct_name s, size_m start); \
+				linkage size_m function_name_prefix##find_first_clear(mumaResult* result, struct_name s, size_m start); \
+				linkage struct_name function_name_prefix##and(mumaResult* result, struct_name s, struct_name other); \
+				linkage struct_name function_name_prefix##or(mumaResult* result, struct_name s, struct_name other); \
+				linkage struct_name function_name_prefix##xor(mumaResult* result, struct_name s, struct_name other); \
+				linkage struct_name function_name_prefix##not(mumaResult* result, struct_name s);
+
+			#define mu_bit_array_definitions(struct_name, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Resize @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##resize` is used to resize a bit array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `length`, and any new bits will be 0. Like the dynamic array, the allocated words double or halve as needed. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m words = (length+63)/64; \
+					size_m old_words = (s.length+63)/64; \
+					size_m capacity = s.allocated_length/64; \
+					\
+					if (words == 0 && s.data == MU_NULL_PTR) { \
+						s.length = 0; \
+						return s; \
+					} \
+					\
+					if ((words > capacity) || (words < capacity/2)) { \
+						size_m new_capacity = (capacity == 0) ? 1 : capacity; \
+						while (words > new_capacity) { \
+							new_capacity *= 2; \
+						} \
+						while (words < new_capacity/2) { \
+							new_capacity /= 2; \
+						} \
+						\
+						mumaResult res = MUMA_SUCCESS; \
+						uint64_m* new_data = (uint64_m*)muma_realloc(&res, s.data, sizeof(uint64_m)*capacity, sizeof(uint64_m)*new_capacity); \
+						if (new_data == MU_NULL_PTR) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						if (new_capacity > capacity) { \
+							mu_memset(&new_data[capacity], 0, sizeof(uint64_m)*(new_capacity-capacity)); \
+						} \
+						\
+						s.data = new_data; \
+						s.allocated_length = new_capacity*64; \
+						if (old_words > new_capacity) { \
+							old_words = new_capacity; \
+						} \
+					} \
+					\
+					/* Keep every bit past the new length 0 */ \
+					if (length < s.length) { \
+						if (length%64 != 0) { \
+							s.data[length/64] &= ((uint64_m)1 << (length%64)) - 1; \
+						} \
+						if (old_words > words) { \
+							mu_memset(&s.data[words], 0, sizeof(uint64_m)*(old_words-words)); \
+						} \
+					} \
+					\
+					s.length = length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create a bit array with every bit set to 0, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that `length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.data = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					return function_name_prefix##resize(result, s, length); \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a bit array and fully free its contents, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.data != MU_NULL_PTR) { \
+						muma_free(s.data, sizeof(uint64_m)*(s.allocated_length/64)); \
+						s.data = MU_NULL_PTR; \
+					} \
+					\
+					s.allocated_length = 0; \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push a bit on top of a bit array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, muBool value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, muBool value) { \
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##resize(&res, s, s.length+1); \
+					MU_SET_RESULT(result, res) \
+					if (res != MUMA_SUCCESS) { \
+						return s; \
+					} \
+					\
+					if (value) { \
+						s.data[(s.length-1)/64] |= (uint64_m)1 << ((s.length-1)%64); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Set @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##set` is used to set the value of a bit, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, muBool value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `index` is out of range, nothing is modified and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, muBool value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					if (value) { \
+						s.data[index/64] |= (uint64_m)1 << (index%64); \
+					} else { \
+						s.data[index/64] &= ~((uint64_m)1 << (index%64)); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Test @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##test` is used to get the value of a bit, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##test(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `index` is out of range, `MU_FALSE` is returned and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##test(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return MU_FALSE; \
+					} \
+					\
+					return (s.data[index/64] >> (index%64)) & 1; \
+				} \
+				\
+				/*@DOCBEGIN #### Count @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##count` returns the amount of set bits in a bit array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##count(struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##count(struct_name s) { \
+					size_m words = (s.length+63)/64; \
+					size_m count = 0; \
+					for (size_m i = 0; i < words; i++) { \
+						count += MUMA_POPCOUNT64(s.data[i]); \
+					} \
+					return count; \
+				} \
+				\
+				/*@DOCBEGIN #### Find first set @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find_first_set` is used to find the first set bit at or after a given index, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##find_first_set(mumaResult* result, struct_name s, size_m start) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If a set bit is found, its index is returned. If not, `MU_SIZE_MAX` is returned and `MUMA_NOT_FOUND` is the result. Passing the last found index plus one as `start` iterates over every set bit. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##find_first_set(mumaResult* result, struct_name s, size_m start) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (start < s.length) { \
+						size_m words = (s.length+63)/64; \
+						size_m w = start/64; \
+						uint64_m word = s.data[w] & (~(uint64_m)0 << (start%64)); \
+						while (MU_TRUE) { \
+							if (word != 0) { \
+								return w*64 + MUMA_CTZ64(word); \
+							} \
+							if (++w >= words) { \
+								break; \
+							} \
+							word = s.data[w]; \
+						} \
+					} \
+					\
+					MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+					return MU_SIZE_MAX; \
+				} \
+				\
+				/*@DOCBEGIN #### Find first clear @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##find_first_clear` is used to find the first bit that isn't set at or after a given index, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##find_first_clear(mumaResult* result, struct_name s, size_m start) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If a clear bit is found, its index is returned. If not, `MU_SIZE_MAX` is returned and `MUMA_NOT_FOUND` is the result. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##find_first_clear(mumaResult* result, struct_name s, size_m start) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (start < s.length) { \
+						size_m words = (s.length+63)/64; \
+						size_m w = start/64; \
+						uint64_m word = ~s.data[w] & (~(uint64_m)0 << (start%64)); \
+						while (MU_TRUE) { \
+							if (word != 0) { \
+								size_m index = w*64 + MUMA_CTZ64(word); \
+								if (index < s.length) { \
+									return index; \
+								} \
+								break; \
+							} \
+							if (++w >= words) { \
+								break; \
+							} \
+							word = ~s.data[w]; \
+						} \
+					} \
+					\
+					MU_SET_RESULT(result, MUMA_NOT_FOUND) \
+					return MU_SIZE_MAX; \
+				} \
+				\
+				/*@DOCBEGIN #### Bitwise operations @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The functions `function_name_prefix##and`, `function_name_prefix##or`, and `function_name_prefix##xor` are used to perform a bitwise operation between every bit of two bit arrays, storing the result in the first one, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##and(mumaResult* result, struct_name s, struct_name other) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##or(mumaResult* result, struct_name s, struct_name other) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##xor(mumaResult* result, struct_name s, struct_name other) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `s.length` never changes; if `other` is shorter than `s`, its missing bits are treated as 0. These operations work on whole words in a simple loop that compilers can vectorize. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##and(mumaResult* result, struct_name s, struct_name other) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m words = (s.length+63)/64; \
+					size_m other_words = (other.length+63)/64; \
+					size_m n = (words < other_words) ? words : other_words; \
+					for (size_m i = 0; i < n; i++) { \
+						s.data[i] &= other.data[i]; \
+					} \
+					if (n < words) { \
+						mu_memset(&s.data[n], 0, sizeof(uint64_m)*(words-n)); \
+					} \
+					return s; \
+				} \
+				\
+				linkage struct_name function_name_prefix##or(mumaResult* result, struct_name s, struct_name other) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m words = (s.length+63)/64; \
+					size_m other_words = (other.length+63)/64; \
+					size_m n = (words < other_words) ? words : other_words; \
+					for (size_m i = 0; i < n; i++) { \
+						s.data[i] |= other.data[i]; \
+					} \
+					if (n != 0 && n == words && s.length%64 != 0) { \
+						s.data[n-1] &= ((uint64_m)1 << (s.length%64)) - 1; \
+					} \
+					return s; \
+				} \
+				\
+				linkage struct_name function_name_prefix##xor(mumaResult* result, struct_name s, struct_name other) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m words = (s.length+63)/64; \
+					size_m other_words = (other.length+63)/64; \
+					size_m n = (words < other_words) ? words : other_words; \
+					for (size_m i = 0; i < n; i++) { \
+						s.data[i] ^= other.data[i]; \
+					} \
+					if (n != 0 && n == words && s.length%64 != 0) { \
+						s.data[n-1] &= ((uint64_m)1 << (s.length%64)) - 1; \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Not @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##not` is used to flip every bit in a bit array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##not(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##not(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m words = (s.length+63)/64; \
+					for (size_m i = 0; i < words; i++) { \
+						s.data[i] = ~s.data[i]; \
+					} \
+					if (words != 0 && s.length%64 != 0) { \
+						s.data[words-1] &= ((uint64_m)1 << (s.length%64)) - 1; \
+					} \
+					return s; \
+				}
+
+			#define mu_bit_array_declaration(struct_name, function_name_prefix) \
+				mu_bit_array_struct(struct_name) \
+				mu_bit_array_definitions(struct_name, function_name_prefix, )
+
+			#define mu_bit_array_header(struct_name, function_name_prefix) \
+				mu_bit_array_struct(struct_name) \
+				mu_bit_array_prototypes(struct_name, function_name_prefix, )
+
+			#define mu_bit_array_impl(struct_name, function_name_prefix) \
+				mu_bit_array_definitions(struct_name, function_name_prefix, )
+
+			#define mu_bit_array_static_declaration(struct_name, function_name_prefix) \
+				mu_bit_array_struct(struct_name) \
+				mu_bit_array_definitions(struct_name, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Packed array
+
+			/* @DOCBEGIN
+
+			The macro `mu_packed_array_declaration` is a macro function that is used to create a packed array, which is an append-only array of `uint64_m` values stored compressed: values are grouped into blocks of `MUMA_PACKED_BLOCK_LENGTH` (128), and each block is bit-packed with the smallest width that fits every value in it, relative to a per-block base ("frame of reference"). Optionally, the differences between consecutive values can be stored instead of the values themselves ("delta encoding"), which makes sorted data (such as lists of IDs) very small. Its parameters look like this:
+
+			```c
+			mu_packed_array_declaration(struct_name, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the packed array struct that will be created.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Struct
+
+			The packed array expands to do a few things. The first thing it does is create a struct for the packed array, following this expansion:
+
+			```c
+			struct struct_name {
+				uint64_m* words;
+				mumaPackedBlock* blocks;
+				uint64_m* tail;
+				size_m word_count;
+				size_m allocated_words;
+				size_m block_count;
+				size_m allocated_blocks;
+				size_m length;
+				muBool delta;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`words` holds the bit-packed values of every full block (plus a word of padding at the end), and `blocks` holds the `block_count` full blocks, whose struct is defined as so:
+
+			```c
+			struct mumaPackedBlock {
+				uint64_m base;
+				size_m word_offset;
+				uint32_m width;
+			}; typedef struct mumaPackedBlock mumaPackedBlock;
+			```
+
+			A block with a width of `w` bits takes up exactly `2*w` words, starting at `word_offset`. Without delta encoding, `base` is the smallest value in the block, and the block stores each value minus `base`; with delta encoding, `base` is the first value in the block, and the block stores each value minus the one before it (0 for the first value).
+
+			`tail` holds the last `length % MUMA_PACKED_BLOCK_LENGTH` values uncompressed, which are packed once the block is full.
+
+			Note that these members aren't meant to be modified by the user, only read.
+
+			Note that delta encoding doesn't require the values to be sorted (differences wrap around), but unsorted values will usually need wide blocks. Also note that random access into a delta-encoded block needs to add up the differences before the value, so scanning should be done block by block with `function_name_prefix##decode_block` instead.
+
+			### Linkage
+
+			Since `mu_packed_array_declaration` defines its functions with external linkage, it can only be expanded in one translation unit. The following macros take the same parameters and correspond to the dynamic array ones described in its linkage section: `mu_packed_array_header` defines the struct and declares the functions, `mu_packed_array_impl` defines the functions in one translation unit, and `mu_packed_array_static_declaration` defines everything as `static inline`.
+
+			```c
+			mu_packed_array_header(struct_name, function_name_prefix)
+			mu_packed_array_impl(struct_name, function_name_prefix)
+			mu_packed_array_static_declaration(struct_name, function_name_prefix)
+			```
+
+			They are built on `mu_packed_array_struct(struct_name)`, `mu_packed_array_prototypes(struct_name, function_name_prefix, linkage)`, and `mu_packed_array_definitions(struct_name, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			struct mumaPackedBlock {
+				uint64_m base;
+				size_m word_offset;
+				uint32_m width;
+			}; typedef struct mumaPackedBlock mumaPackedBlock;
+
+			#define MUMA_PACKED_BLOCK_LENGTH 128
+
+			// Amount of bits needed to store `x`
+			static MUMA_INLINE uint32_m muma_packed_width(uint64_m x) {
+				uint32_m width = 0;
+				while (width < 64 && (x >> width) != 0) {
+					width++;
+				}
+				return width;
+			}
+
+			// Packs a block of values with the given width into 2*width
+			// words; values may straddle two words, but never the end of
+			// the block, since 128*width is a multiple of 64.
+			static MUMA_INLINE void muma_packed_pack(const uint64_m* values, uint64_m* words, uint32_m width) {
+				if (width == 0) {
+					return;
+				}
+
+				uint64_m acc = 0;
+				uint32_m filled = 0;
+				for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+					acc |= values[i] << filled;
+					if (filled + width >= 64) {
+						*words++ = acc;
+						uint32_m left = filled + width - 64;
+						acc = (left == 0) ? 0 : values[i] >> (width - left);
+						filled = left;
+					} else {
+						filled += width;
+					}
+				}
+			}
+
+			// Gets the value at `index` in a block packed with `width`
+			static MUMA_INLINE uint64_m muma_packed_extract(const uint64_m* words, uint32_m width, size_m index) {
+				if (width == 0) {
+					return 0;
+				}
+
+				size_m bit = index * width;
+				uint32_m offset = (uint32_m)(bit & 63);
+				uint64_m v = words[bit >> 6] >> offset;
+				if (offset + width > 64) {
+					v |= words[(bit >> 6) + 1] << (64 - offset);
+				}
+				return (width == 64) ? v : (v & ((((uint64_m)1) << width) - 1));
+			}
+
+			// Unpacks a whole block and undoes its encoding. The width is
+			// fixed for the whole loop and every iteration is independent
+			// (except for the delta prefix sum afterwards), so compilers
+			// can unroll and vectorize it.
+			static MUMA_INLINE void muma_packed_unpack(const uint64_m* words, const mumaPackedBlock* block, muBool delta, uint64_m* values) {
+				uint32_m width = block->width;
+				if (width == 0) {
+					for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+						values[i] = 0;
+					}
+				} else if (width == 64) {
+					for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+						values[i] = words[i];
+					}
+				} else {
+					uint64_m mask = (((uint64_m)1) << width) - 1;
+					for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+						size_m bit = i * width;
+						uint32_m offset = (uint32_m)(bit & 63);
+						/* The next word is always read (there's a word of padding */
+						/* after the last block), and shifted in by 64-offset */
+						/* as two shifts so that an offset of 0 shifts it out */
+						/* entirely; this keeps the loop free of branches. */
+						uint64_m lo = words[bit >> 6] >> offset;
+						uint64_m hi = (words[(bit >> 6) + 1] << 1) << (63 - offset);
+						values[i] = (lo | hi) & mask;
+					}
+				}
+
+				if (delta) {
+					uint64_m v = block->base;
+					for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+						v += values[i];
+						values[i] = v;
+					}
+				} else {
+					for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) {
+						values[i] += block->base;
+					}
+				}
+			}
+
+			// Offset of the block headers and total size of the allocation
+			// holding a packed array's tail and block headers
+			#define MUMA_PACKED_BLOCKS_OFFSET (sizeof(uint64_m)*MUMA_PACKED_BLOCK_LENGTH)
+			#define muma_packed_blocks_size(capacity) (MUMA_PACKED_BLOCKS_OFFSET + sizeof(mumaPackedBlock)*(capacity))
+
+			#define mu_packed_array_struct(struct_name) \
+				\
+				struct struct_name { \
+					uint64_m* words; \
+					mumaPackedBlock* blocks; \
+					uint64_m* tail; \
+					size_m word_count; \
+					size_m allocated_words; \
+					size_m block_count; \
+					size_m allocated_blocks; \
+					size_m length; \
+					muBool delta; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_packed_array_prototypes(struct_name, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, muBool delta); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, uint64_m value); \
+				linkage uint64_m function_name_prefix##get(mumaResult* result, struct_name s, size_m index); \
+				linkage size_m function_name_prefix##decode_block(mumaResult* result, struct_name s, size_m block, uint64_m* values);
+
+			#define mu_packed_array_definitions(struct_name, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty packed array, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, muBool delta) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `delta` is whether or not blocks are delta-encoded. Nothing is allocated until the first value is pushed. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, muBool delta) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.words = MU_NULL_PTR; \
+					s.blocks = MU_NULL_PTR; \
+					s.tail = MU_NULL_PTR; \
+					s.word_count = 0; \
+					s.allocated_words = 0; \
+					s.block_count = 0; \
+					s.allocated_blocks = 0; \
+					s.length = 0; \
+					s.delta = delta; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a packed array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.words != MU_NULL_PTR) { \
+						muma_free(s.words, sizeof(uint64_m)*s.allocated_words); \
+					} \
+					if (s.tail != MU_NULL_PTR) { \
+						muma_free(s.tail, muma_packed_blocks_size(s.allocated_blocks)); \
+					} \
+					return function_name_prefix##create(MU_NULL_PTR, s.delta); \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push a value onto the end of a packed array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, uint64_m value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The value is written to the tail; once the tail holds a full block, the block is packed onto the end of `words`. Both `words` and `blocks` double in size when they're full. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, uint64_m value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					size_m tail_length = s.length - s.block_count*MUMA_PACKED_BLOCK_LENGTH; \
+					\
+					/* Makes sure that a block header is free for when the tail */ \
+					/* fills up, so that packing never has to fail halfway. */ \
+					if (s.tail == MU_NULL_PTR || (tail_length == MUMA_PACKED_BLOCK_LENGTH-1 && s.block_count == s.allocated_blocks)) { \
+						size_m allocated_blocks = (s.allocated_blocks == 0) ? 1 : s.allocated_blocks*2; \
+						uint64_m* tail = (uint64_m*)muma_realloc(&res, s.tail, \
+							(s.tail == MU_NULL_PTR) ? 0 : muma_packed_blocks_size(s.allocated_blocks), \
+							muma_packed_blocks_size(allocated_blocks) \
+						); \
+						if (tail == 0) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						s.tail = tail; \
+						s.blocks = (mumaPackedBlock*)(((muByte*)tail) + MUMA_PACKED_BLOCKS_OFFSET); \
+						s.allocated_blocks = allocated_blocks; \
+					} \
+					\
+					if (tail_length == MUMA_PACKED_BLOCK_LENGTH-1) { \
+						s.tail[tail_length] = value; \
+						mumaPackedBlock block; \
+						block.word_offset = s.word_count; \
+						\
+						/* Encode the tail in place, and find the width needed */ \
+						if (s.delta) { \
+							block.base = s.tail[0]; \
+							uint64_m previous = s.tail[0]; \
+							uint64_m bits = 0; \
+							for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) { \
+								uint64_m v = s.tail[i]; \
+								s.tail[i] = v - previous; \
+								previous = v; \
+								bits |= s.tail[i]; \
+							} \
+							block.width = muma_packed_width(bits); \
+						} else { \
+							uint64_m min = s.tail[0]; \
+							for (size_m i = 1; i < MUMA_PACKED_BLOCK_LENGTH; i++) { \
+								min = (s.tail[i] < min) ? s.tail[i] : min; \
+							} \
+							block.base = min; \
+							uint64_m bits = 0; \
+							for (size_m i = 0; i < MUMA_PACKED_BLOCK_LENGTH; i++) { \
+								s.tail[i] -= min; \
+								bits |= s.tail[i]; \
+							} \
+							block.width = muma_packed_width(bits); \
+						} \
+						\
+						/* One more word than needed is kept as padding for */ \
+						/* muma_packed_unpack. */ \
+						size_m word_count = s.word_count + 2*(size_m)block.width; \
+						if (word_count+1 > s.allocated_words) { \
+							size_m allocated_words = (s.allocated_words == 0) ? word_count+1 : s.allocated_words; \
+							while (allocated_words < word_count+1) { \
+								allocated_words *= 2; \
+							} \
+							uint64_m* words = (uint64_m*)muma_realloc(&res, s.words, sizeof(uint64_m)*s.allocated_words, sizeof(uint64_m)*allocated_words); \
+							if (words == 0) { \
+								/* Undo the encoding, leaving the array as it was */ \
+								mumaPackedBlock undo = block; \
+								undo.width = 64; \
+								muma_packed_unpack(s.tail, &undo, s.delta, s.tail); \
+								MU_SET_RESULT(result, res) \
+								return s; \
+							} \
+							s.words = words; \
+							s.allocated_words = allocated_words; \
+						} \
+						\
+						if (block.width != 0) { \
+							muma_packed_pack(s.tail, &s.words[s.word_count], block.width); \
+						} \
+						s.word_count = word_count; \
+						s.blocks[s.block_count++] = block; \
+					} else { \
+						s.tail[tail_length] = value; \
+					} \
+					\
+					s.length++; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Get @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##get` is used to get a value in a packed array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN uint64_m function_name_prefix##get(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This is O(1) without delta encoding, and O(`MUMA_PACKED_BLOCK_LENGTH`) at worst with it. If `index` is out of range, 0 is returned and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage uint64_m function_name_prefix##get(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return 0; \
+					} \
+					\
+					size_m b = index / MUMA_PACKED_BLOCK_LENGTH; \
+					size_m i = index % MUMA_PACKED_BLOCK_LENGTH; \
+					if (b == s.block_count) { \
+						return s.tail[i]; \
+					} \
+					\
+					const mumaPackedBlock* block = &s.blocks[b]; \
+					const uint64_m* words = &s.words[block->word_offset]; \
+					if (!s.delta) { \
+						return block->base + muma_packed_extract(words, block->width, i); \
+					} \
+					uint64_m v = block->base; \
+					for (size_m j = 1; j <= i; j++) { \
+						v += muma_packed_extract(words, block->width, j); \
+					} \
+					return v; \
+				} \
+				\
+				/*@DOCBEGIN #### Decode block @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##decode_block` is used to decode a whole block of a packed array at once, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##decode_block(mumaResult* result, struct_name s, size_m block, uint64_m* values) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `values` must have room for `MUMA_PACKED_BLOCK_LENGTH` values; the values of block `block` (meaning the values from index `block*MUMA_PACKED_BLOCK_LENGTH` onward) are written to it, and the amount written is returned. Blocks go up to `(s.length+MUMA_PACKED_BLOCK_LENGTH-1)/MUMA_PACKED_BLOCK_LENGTH`, the last of which may be the partially filled tail. This is the fastest way to scan a packed array. If `block` is out of range, 0 is returned and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##decode_block(mumaResult* result, struct_name s, size_m block, uint64_m* values) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (block < s.block_count) { \
+						muma_packed_unpack(&s.words[s.blocks[block].word_offset], &s.blocks[block], s.delta, values); \
+						return MUMA_PACKED_BLOCK_LENGTH; \
+					} \
+					\
+					size_m tail_length = s.length - s.block_count*MUMA_PACKED_BLOCK_LENGTH; \
+					if (block > s.block_count || tail_length == 0) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return 0; \
+					} \
+					mu_memcpy(values, s.tail, sizeof(uint64_m)*tail_length); \
+					return tail_length; \
+				}
+
+			#define mu_packed_array_declaration(struct_name, function_name_prefix) \
+				mu_packed_array_struct(struct_name) \
+				mu_packed_array_definitions(struct_name, function_name_prefix, )
+
+			#define mu_packed_array_header(struct_name, function_name_prefix) \
+				mu_packed_array_struct(struct_name) \
+				mu_packed_array_prototypes(struct_name, function_name_prefix, )
+
+			#define mu_packed_array_impl(struct_name, function_name_prefix) \
+				mu_packed_array_definitions(struct_name, function_name_prefix, )
+
+			#define mu_packed_array_static_declaration(struct_name, function_name_prefix) \
+				mu_packed_array_struct(struct_name) \
+				mu_packed_array_definitions(struct_name, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Struct of arrays
+
+			/* @DOCBEGIN
+
+			The macro `mu_soa_declaration` is a macro function that is used to create a struct of arrays, which is a dynamic array of records whose fields are each stored in their own contiguous array (a "column"), instead of whole records being stored one after another. This means that a loop touching only one or two fields of every record only pulls those fields through the cache, and can be vectorized as a simple loop over a column. Its parameters look like this:
+
+			```c
+			mu_soa_declaration(struct_name, fields, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the struct of arrays struct that will be created.
+
+			`fields` is the name of a macro function that lists every field of a record, taking in the name of another macro function, and calling it once with the type and name of each field. For example:
+
+			```c
+			#define PARTICLE_FIELDS(X) \
+				X(float, x) \
+				X(float, y) \
+				X(float, speed) \
+				X(int, id)
+
+			mu_soa_declaration(particles, PARTICLE_FIELDS, particles_)
+			```
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			Note that a field can't be named `memory`, `allocated_length`, or `length`, and that a field's type can't contain a comma.
+
+			### Structs
+
+			The struct of arrays expands to do a few things. The first thing it does is create a struct to represent a single record, following this expansion (for the fields listed above):
+
+			```c
+			struct struct_name##_record {
+				float x;
+				float y;
+				float speed;
+				int id;
+			}; typedef struct struct_name##_record struct_name##_record;
+			```
+
+			After that, it creates a struct for the struct of arrays itself, following this expansion:
+
+			```c
+			struct struct_name {
+				float* x;
+				float* y;
+				float* speed;
+				int* id;
+				muByte* memory;
+				size_m allocated_length;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			Every column (such as `x`) holds `length` values, and has room for `allocated_length` values. All of the columns are stored in a single allocation, `memory`, with every column starting at a multiple of 64 bytes from its start.
+
+			Note that these members aren't meant to be modified by the user, only read (although the values within the columns can be freely modified).
+
+			### Linkage
+
+			`mu_soa_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. A structure of arrays used across several files can be split into `mu_soa_header` and `mu_soa_impl`, or defined as `static inline` with `mu_soa_static_declaration`, the same way as described in the dynamic array's linkage section. These take the same parameters, including `fields`:
+
+			```c
+			mu_soa_header(struct_name, fields, function_name_prefix)
+			mu_soa_impl(struct_name, fields, function_name_prefix)
+			mu_soa_static_declaration(struct_name, fields, function_name_prefix)
+			```
+
+			They are built on `mu_soa_struct(struct_name, fields)`, `mu_soa_prototypes(struct_name, function_name_prefix, linkage)`, and `mu_soa_definitions(struct_name, fields, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the structs are defined, functions are also defined to interface with and use them. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			// Internal helpers that are passed to the field list macro; the
+			// ones that refer to `s`, `n`, `index`, `count`, or `r` rely on
+			// those variables being in scope where they're used.
+			#define muma_soa_column_size(type_size, capacity) ((((type_size)*(capacity))+63) & ~(size_m)63)
+			#define MUMA_SOA_RECORD_MEMBER(type, name) type name;
+			#define MUMA_SOA_COLUMN_MEMBER(type, name) type* name;
+			#define MUMA_SOA_SIZE(type, name) + muma_soa_column_size(sizeof(type), capacity)
+			#define MUMA_SOA_ASSIGN(type, name) n.name = (type*)&n.memory[offset]; offset += muma_soa_column_size(sizeof(type), capacity);
+			#define MUMA_SOA_NULL(type, name) s.name = MU_NULL_PTR;
+			#define MUMA_SOA_COPY(type, name) mu_memcpy(n.name, s.name, sizeof(type)*s.length);
+			#define MUMA_SOA_ZERO(type, name) mu_memset(&s.name[index], 0, sizeof(type)*count);
+			#define MUMA_SOA_SET(type, name) s.name[index] = r.name;
+			#define MUMA_SOA_GET(type, name) r.name = s.name[index];
+			#define MUMA_SOA_ERASE(type, name) mu_memmove(&s.name[index], &s.name[index+count], sizeof(type)*(s.length-index-count));
+			#define MUMA_SOA_SWAP_ERASE(type, name) s.name[index] = s.name[s.length-1];
+
+			#define mu_soa_struct(struct_name, fields) \
+				\
+				struct struct_name##_record { \
+					fields(MUMA_SOA_RECORD_MEMBER) \
+				}; typedef struct struct_name##_record struct_name##_record; \
+				\
+				struct struct_name { \
+					fields(MUMA_SOA_COLUMN_MEMBER) \
+					muByte* memory; \
+					size_m allocated_length; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_soa_prototypes(struct_name, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length); \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length); \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, struct_name##_record push); \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s); \
+				linkage struct_name##_record function_name_prefix##get(mumaResult* result, struct_name s, size_m index); \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, struct_name##_record set); \
+				linkage struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count); \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index); \
+				linkage struct_name function_name_prefix##swap_erase(mumaResult* result, struct_name s, size_m index);
+
+			#define mu_soa_definitions(struct_name, fields, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Reallocate @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##reallocate` is used to move a struct of arrays to a new allocation with room for exactly a given amount of records, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `allocated_length` is below `s.length`, `MUMA_INVALID_INDEX` is the result and nothing happens. Note that this function is mostly useful for reserving room ahead of time, as `function_name_prefix##resize` (and every function that changes the length) already calls it when needed. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (allocated_length < s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					if (allocated_length == s.allocated_length) { \
+						return s; \
+					} \
+					\
+					struct_name n = s; \
+					n.memory = MU_NULL_PTR; \
+					n.allocated_length = allocated_length; \
+					\
+					if (allocated_length != 0) { \
+						size_m capacity = allocated_length; \
+						mumaResult res = MUMA_SUCCESS; \
+						n.memory = (muByte*)muma_malloc(&res, 0 fields(MUMA_SOA_SIZE)); \
+						if (n.memory == MU_NULL_PTR) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						\
+						size_m offset = 0; \
+						fields(MUMA_SOA_ASSIGN) \
+						(void)offset; \
+						\
+						if (s.memory != MU_NULL_PTR) { \
+							fields(MUMA_SOA_COPY) \
+						} \
+					} else { \
+						struct_name z = MU_ZERO_STRUCT(struct_name); \
+						n = z; \
+					} \
+					\
+					if (s.memory != MU_NULL_PTR) { \
+						size_m capacity = s.allocated_length; \
+						muma_free(s.memory, 0 fields(MUMA_SOA_SIZE)); \
+					} \
+					return n; \
+				} \
+				\
+				/*@DOCBEGIN #### Resize @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##resize` is used to resize a struct of arrays, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `length`, and the values of any new records will be 0. The allocated length changes the same way that a dynamic array's does (doubling or halving as needed), with every column always resized together. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if ((length > s.allocated_length) || (length < s.allocated_length/2)) { \
+						size_m allocated_length = (s.allocated_length == 0) ? 1 : s.allocated_length; \
+						while (length > allocated_length) { \
+							allocated_length *= 2; \
+						} \
+						while (length < allocated_length/2) { \
+							allocated_length /= 2; \
+						} \
+						\
+						if (allocated_length != s.allocated_length) { \
+							mumaResult res = MUMA_SUCCESS; \
+							size_m old_length = s.length; \
+							if (length < s.length) { \
+								s.length = length; \
+							} \
+							s = function_name_prefix##reallocate(&res, s, allocated_length); \
+							if (res != MUMA_SUCCESS) { \
+								s.length = old_length; \
+								MU_SET_RESULT(result, res) \
+								return s; \
+							} \
+						} \
+					} \
+					\
+					if (length > s.length) { \
+						size_m index = s.length; \
+						size_m count = length - s.length; \
+						fields(MUMA_SOA_ZERO) \
+					} \
+					s.length = length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create a struct of arrays, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that `length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					fields(MUMA_SOA_NULL) \
+					s.memory = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					return function_name_prefix##resize(result, s, length); \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a struct of arrays and fully free its contents, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					s.length = 0; \
+					return function_name_prefix##reallocate(result, s, 0); \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push a record on top of a struct of arrays, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, struct_name##_record push) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, struct_name##_record push) { \
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##resize(&res, s, s.length+1); \
+					MU_SET_RESULT(result, res) \
+					if (res != MUMA_SUCCESS) { \
+						return s; \
+					} \
+					\
+					size_m index = s.length-1; \
+					struct_name##_record r = push; \
+					fields(MUMA_SOA_SET) \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop a record from the top of a struct of arrays, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##pop(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s) { \
+					if (s.length == 0) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					return function_name_prefix##resize(result, s, s.length-1); \
+				} \
+				\
+				/*@DOCBEGIN #### Get @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##get` is used to gather every field of a record into a `struct_name##_record`, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name##_record function_name_prefix##get(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If `index` is out of range, a zeroed-out record is returned and `MUMA_INVALID_INDEX` is the result. @NEWLINE @DOCEND */ \
+				linkage struct_name##_record function_name_prefix##get(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name##_record r = MU_ZERO_STRUCT(struct_name##_record); \
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return r; \
+					} \
+					\
+					fields(MUMA_SOA_GET) \
+					return r; \
+				} \
+				\
+				/*@DOCBEGIN #### Set @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##set` is used to scatter every field of a `struct_name##_record` into a record, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, struct_name##_record set) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, struct_name##_record set) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					struct_name##_record r = set; \
+					fields(MUMA_SOA_SET) \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Multi-erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##multierase` is used to erase multiple records, keeping the order of the remaining records, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##multierase(mumaResult* result, struct_name s, size_m index, size_m count) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length || count > s.length-index) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					fields(MUMA_SOA_ERASE) \
+					return function_name_prefix##resize(result, s, s.length-count); \
+				} \
+				\
+				/*@DOCBEGIN #### Erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##erase` is used to erase a record, keeping the order of the remaining records, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function just returns `function_name_prefix##multierase` with the following parameters: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN function_name_prefix##multierase(result, s, index, 1) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) { \
+					return function_name_prefix##multierase(result, s, index, 1); \
+				} \
+				\
+				/*@DOCBEGIN #### Swap-erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##swap_erase` is used to erase a record in O(1) by moving the last record into its place, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##swap_erase(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##swap_erase(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					fields(MUMA_SOA_SWAP_ERASE) \
+					return function_name_prefix##resize(result, s, s.length-1); \
+				}
+
+			#define mu_soa_declaration(struct_name, fields, function_name_prefix) \
+				mu_soa_struct(struct_name, fields) \
+				mu_soa_definitions(struct_name, fields, function_name_prefix, )
+
+			#define mu_soa_header(struct_name, fields, function_name_prefix) \
+				mu_soa_struct(struct_name, fields) \
+				mu_soa_prototypes(struct_name, function_name_prefix, )
+
+			#define mu_soa_impl(struct_name, fields, function_name_prefix) \
+				mu_soa_definitions(struct_name, fields, function_name_prefix, )
+
+			#define mu_soa_static_declaration(struct_name, fields, function_name_prefix) \
+				mu_soa_struct(struct_name, fields) \
+				mu_soa_definitions(struct_name, fields, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Shared array
+
+			/* @DOCBEGIN
+
+			The macro `mu_shared_array_declaration` is a macro function that is used to create a shared array, which is a dynamic array whose memory can be shared between several copies of it using a reference-counted buffer ("copy-on-write"). Making a copy of a shared array is O(1), and the copies only split off into their own memory once one of them is modified, meaning that snapshots of an array can be handed out to many readers without copying (or storing) the array's contents more than once. Its parameters look like this:
+
+			```c
+			mu_shared_array_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the shared array struct that will be created for the given type.
+
+			`type` is the type that will be used to represent an element in the shared array.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Struct
+
+			The shared array expands to do a few things. The first thing it does is create a struct for the shared array, following this expansion:
+
+			```c
+			struct struct_name {
+				type* data;
+				mumaSharedBuffer* buffer;
+				size_m allocated_length;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`data` holds the elements of the array, and is stored in the same allocation as `buffer`, which holds the amount of references to the allocation (changed atomically, so copies can be shared and released across threads) and the allocator that the allocation was made with. Whichever copy drops the last reference frees the allocation through that allocator, releasing it from that allocator's budget, so copies can be handed to threads that use a different allocator or budget.
+
+			Note that these members aren't meant to be modified by the user, only read. In particular, `data` is not allowed to be written to directly while the array is shared; every function that modifies a shared array first makes sure that it is the only reference to its buffer, cloning the buffer if it isn't.
+
+			Note that the elements of a shared array are aligned to 16 bytes in their allocation, meaning that types with a stricter alignment requirement than that are not supported.
+
+			### Linkage
+
+			Like the other containers, `mu_shared_array_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. Since shared arrays are usually handed between files, the declaration can be split into `mu_shared_array_header` (the struct and the prototypes) and `mu_shared_array_impl` (the definitions, in one translation unit); `mu_shared_array_static_declaration` instead defines every function as `static inline`. They take the same parameters and match the dynamic array macros described in its linkage section:
+
+			```c
+			mu_shared_array_header(struct_name, type, function_name_prefix)
+			mu_shared_array_impl(struct_name, type, function_name_prefix)
+			mu_shared_array_static_declaration(struct_name, type, function_name_prefix)
+			```
+
+			They are built on `mu_shared_array_struct(struct_name, type)`, `mu_shared_array_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_shared_array_definitions(struct_name, type, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			// Header at the start of a shared array's allocation; the
+			// allocator it was allocated with is kept, so that whichever
+			// thread drops the last reference frees it through the same
+			// allocator and releases it from the same budget.
+			struct mumaSharedBuffer {
+				size_m references;
+				mumaAllocator allocator;
+			}; typedef struct mumaSharedBuffer mumaSharedBuffer;
+
+			// Offset of the elements and total size of a shared array's
+			// allocation for the given capacity
+			#define MUMA_SHARED_BUFFER_DATA_OFFSET ((sizeof(mumaSharedBuffer)+15) & ~(size_m)15)
+			#define muma_shared_buffer_size(type_size, capacity) (MUMA_SHARED_BUFFER_DATA_OFFSET + (type_size)*(capacity))
+
+			#define mu_shared_array_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					type* data; \
+					mumaSharedBuffer* buffer; \
+					size_m allocated_length; \
+					size_m length; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_shared_array_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length); \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##share(mumaResult* result, struct_name s); \
+				linkage muBool function_name_prefix##is_shared(struct_name s); \
+				linkage struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length); \
+				linkage struct_name function_name_prefix##detach(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length); \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, type value); \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value); \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s); \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert); \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index);
+
+			#define mu_shared_array_definitions(struct_name, type, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create a shared array, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The elements of the created array are zeroed out, and it starts out with a single reference to its buffer. Note that `length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.data = MU_NULL_PTR; \
+					s.buffer = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					\
+					if (length == 0) { \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s.buffer = (mumaSharedBuffer*)muma_malloc(&res, muma_shared_buffer_size(sizeof(type), length)); \
+					if (s.buffer == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					s.buffer->references = 1; \
+					s.buffer->allocator = muma_get_allocator(); \
+					s.data = (type*)(((muByte*)s.buffer) + MUMA_SHARED_BUFFER_DATA_OFFSET); \
+					s.allocated_length = length; \
+					s.length = length; \
+					mu_memset(s.data, 0, sizeof(type)*length); \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to release a shared array's reference to its buffer, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The buffer is only freed once every copy sharing it has been destroyed. Note that this function is safe to call on an array with nothing allocated (of course, assuming that its members are valid). @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##destroy(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.buffer != MU_NULL_PTR) { \
+						if (MUMA_ATOMIC_SUB_FETCH(&s.buffer->references, 1) == 0) { \
+							mumaAllocator allocator = s.buffer->allocator; \
+							muma_allocator_free(&allocator, s.buffer, muma_shared_buffer_size(sizeof(type), s.allocated_length)); \
+						} \
+					} \
+					\
+					s.data = MU_NULL_PTR; \
+					s.buffer = MU_NULL_PTR; \
+					s.allocated_length = 0; \
+					s.length = 0; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Share @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##share` is used to make a copy of a shared array that shares its buffer, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##share(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function adds a reference to the buffer of `s` and returns the copy, which is O(1) no matter the length of the array. Both `s` and the returned copy must be destroyed with `function_name_prefix##destroy`. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##share(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.buffer != MU_NULL_PTR) { \
+						MUMA_ATOMIC_ADD_FETCH(&s.buffer->references, 1); \
+					} \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Is shared @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##is_shared` is used to check if a shared array's buffer is currently shared with another copy, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##is_shared(struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##is_shared(struct_name s) { \
+					return s.buffer != MU_NULL_PTR && MUMA_ATOMIC_LOAD(&s.buffer->references) > 1; \
+				} \
+				\
+				/*@DOCBEGIN #### Reallocate @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##reallocate` is used to move a shared array into a buffer that it doesn't share with any other copy and that can hold exactly a certain amount of elements, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the buffer isn't shared, it is reallocated in place; if it is, a new buffer is allocated and the elements are copied over to it, meaning that cloning a shared buffer and changing its size happen with a single copy. If `allocated_length` is below `s.length`, the array is cut down to `allocated_length` elements. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##reallocate(mumaResult* result, struct_name s, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (allocated_length == 0) { \
+						return function_name_prefix##destroy(result, s); \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					size_m length = (s.length < allocated_length) ? s.length : allocated_length; \
+					mumaSharedBuffer* buffer; \
+					\
+					if (s.buffer != MU_NULL_PTR && MUMA_ATOMIC_LOAD(&s.buffer->references) == 1) { \
+						if (allocated_length == s.allocated_length) { \
+							return s; \
+						} \
+						mumaAllocator allocator = s.buffer->allocator; \
+						buffer = (mumaSharedBuffer*)muma_allocator_realloc(&res, &allocator, s.buffer, \
+							muma_shared_buffer_size(sizeof(type), s.allocated_length), \
+							muma_shared_buffer_size(sizeof(type), allocated_length) \
+						); \
+						if (buffer == 0) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+					} else { \
+						buffer = (mumaSharedBuffer*)muma_malloc(&res, muma_shared_buffer_size(sizeof(type), allocated_length)); \
+						if (buffer == 0) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+						\
+						buffer->references = 1; \
+						buffer->allocator = muma_get_allocator(); \
+						if (s.buffer != MU_NULL_PTR) { \
+							mu_memcpy(((muByte*)buffer) + MUMA_SHARED_BUFFER_DATA_OFFSET, s.data, sizeof(type)*length); \
+							s = function_name_prefix##destroy(&res, s); \
+						} \
+					} \
+					\
+					s.buffer = buffer; \
+					s.data = (type*)(((muByte*)buffer) + MUMA_SHARED_BUFFER_DATA_OFFSET); \
+					s.allocated_length = allocated_length; \
+					s.length = length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Detach @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##detach` is used to make sure that a shared array doesn't share its buffer with any other copy, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##detach(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the buffer is shared, it is cloned, after which the elements of `s.data` are allowed to be written to directly. If it isn't shared, nothing happens. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##detach(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (!function_name_prefix##is_shared(s)) { \
+						return s; \
+					} \
+					return function_name_prefix##reallocate(result, s, s.allocated_length); \
+				} \
+				\
+				/*@DOCBEGIN #### Resize @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##resize` is used to resize a shared array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If this function performs correctly, `s.length` will be equal to `length`, and the array will not share its buffer with any other copy. New elements are zeroed out. The allocated length follows the same doubling and halving as a dynamic array. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##resize(mumaResult* result, struct_name s, size_m length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					size_m allocated_length = (s.allocated_length == 0) ? length : s.allocated_length; \
+					if (length == 0) { \
+						allocated_length = 0; \
+					} \
+					while (length > allocated_length) { \
+						allocated_length *= 2; \
+					} \
+					while (length < allocated_length/2) { \
+						allocated_length /= 2; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					if (allocated_length != s.allocated_length || function_name_prefix##is_shared(s)) { \
+						s = function_name_prefix##reallocate(&res, s, allocated_length); \
+						if (res != MUMA_SUCCESS) { \
+							MU_SET_RESULT(result, res) \
+							return s; \
+						} \
+					} \
+					\
+					if (length > s.length) { \
+						mu_memset(&s.data[s.length], 0, sizeof(type)*(length-s.length)); \
+					} \
+					s.length = length; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Set @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##set` is used to set an element of a shared array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##set(mumaResult* result, struct_name s, size_m index, type value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##detach(&res, s); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					s.data[index] = value; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element onto the end of a shared array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##push(mumaResult* result, struct_name s, type value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##resize(&res, s, s.length+1); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					s.data[s.length-1] = value; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop an element from the end of a shared array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##pop(mumaResult* result, struct_name s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##pop(mumaResult* result, struct_name s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (s.length == 0) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					return function_name_prefix##resize(result, s, s.length-1); \
+				} \
+				\
+				/*@DOCBEGIN #### Insert @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##insert` is used to insert an element into a shared array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `index` is allowed to be `s.length`, in which case the element is pushed onto the end of the array. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##insert(mumaResult* result, struct_name s, size_m index, type insert) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index > s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##resize(&res, s, s.length+1); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					mu_memmove(&s.data[index+1], &s.data[index], sizeof(type)*((s.length-1)-index)); \
+					s.data[index] = insert; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Erase @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##erase` is used to erase an element from a shared array, keeping the order of the remaining elements, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##erase(mumaResult* result, struct_name s, size_m index) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (index >= s.length) { \
+						MU_SET_RESULT(result, MUMA_INVALID_INDEX) \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					s = function_name_prefix##detach(&res, s); \
+					if (res != MUMA_SUCCESS) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					mu_memmove(&s.data[index], &s.data[index+1], sizeof(type)*((s.length-1)-index)); \
+					return function_name_prefix##resize(result, s, s.length-1); \
+				}
+
+			#define mu_shared_array_declaration(struct_name, type, function_name_prefix) \
+				mu_shared_array_struct(struct_name, type) \
+				mu_shared_array_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_shared_array_header(struct_name, type, function_name_prefix) \
+				mu_shared_array_struct(struct_name, type) \
+				mu_shared_array_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_shared_array_impl(struct_name, type, function_name_prefix) \
+				mu_shared_array_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_shared_array_static_declaration(struct_name, type, function_name_prefix) \
+				mu_shared_array_struct(struct_name, type) \
+				mu_shared_array_definitions(struct_name, type, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Concurrent array
+
+			/* @DOCBEGIN
+
+			The macro `mu_concurrent_array_declaration` is a macro function that is used to create a concurrent array, which is an append-only dynamic array that one thread (the "writer") can push onto while any amount of other threads (the "readers") iterate it at the same time, without any locks. When the array grows, the new buffer is published atomically, and the old buffer is retired through epoch-based reclamation (see the epoch functions) instead of being freed right away, so a reader that is still iterating the old buffer never touches freed memory. Its parameters look like this:
+
+			```c
+			mu_concurrent_array_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the concurrent array struct that will be created for the given type.
+
+			`type` is the type that will be used to represent an element in the concurrent array.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Structs
+
+			The concurrent array expands to do a few things. The first thing it does is create a struct for the concurrent array, following this expansion:
+
+			```c
+			struct struct_name {
+				void* buffer;
+				size_m length;
+			}; typedef struct struct_name struct_name;
+			```
+
+			`buffer` points to the current `mumaConcurrentBuffer`, which holds the array's capacity followed by its elements (aligned to 16 bytes), and `length` is the amount of elements pushed so far. Both are changed atomically by the writer, and aren't meant to be read directly; readers should take a snapshot instead, whose struct follows this expansion:
+
+			```c
+			struct struct_name##_snapshot {
+				const type* data;
+				size_m length;
+				size_m epoch;
+			}; typedef struct struct_name##_snapshot struct_name##_snapshot;
+			```
+
+			`data` and `length` are a consistent view of the array at the time the snapshot was taken, and stay valid until the snapshot is ended. `epoch` is the token used to end it.
+
+			Unlike most other containers in muma, a concurrent array is modified through a pointer, since every thread needs to see the same struct.
+
+			Note that, since retired buffers can be freed by whichever thread reclaims them, a concurrent array should only be used with an allocator that every thread using it can free with (such as the default allocator).
+
+			### Linkage
+
+			`mu_concurrent_array_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. Since readers and writers often live in different files, the declaration can be split into `mu_concurrent_array_header`, which defines both structs and declares the functions, and `mu_concurrent_array_impl`, which defines the functions in exactly one translation unit; `mu_concurrent_array_static_declaration` defines everything as `static inline` instead, which lets `function_name_prefix##read_begin` and `function_name_prefix##read_end` inline into a reader's loop. All three take the same parameters and match the dynamic array macros described in its linkage section:
+
+			```c
+			mu_concurrent_array_header(struct_name, type, function_name_prefix)
+			mu_concurrent_array_impl(struct_name, type, function_name_prefix)
+			mu_concurrent_array_static_declaration(struct_name, type, function_name_prefix)
+			```
+
+			They are built on `mu_concurrent_array_struct(struct_name, type)`, `mu_concurrent_array_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_concurrent_array_definitions(struct_name, type, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the structs are defined, functions are also defined to interface with and use these structs. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			// Written into the start of a retired allocation, linking it
+			// into the list of allocations waiting to be freed; the
+			// retiring thread's allocator (and so its budget) is kept, so
+			// that it's freed correctly by whichever thread reclaims it.
+			struct mumaEpochNode {
+				struct mumaEpochNode* next;
+				size_m size;
+				mumaAllocator allocator;
+			}; typedef struct mumaEpochNode mumaEpochNode;
+
+			// Header at the start of a concurrent array's allocation; the
+			// node is only written once the buffer is retired, so readers
+			// can still read `allocated_length` from a retired buffer.
+			struct mumaConcurrentBuffer {
+				mumaEpochNode node;
+				size_m allocated_length;
+			}; typedef struct mumaConcurrentBuffer mumaConcurrentBuffer;
+
+			// Offset of the elements and total size of a concurrent array's
+			// allocation for the given capacity
+			#define MUMA_CONCURRENT_BUFFER_DATA_OFFSET ((sizeof(mumaConcurrentBuffer)+15) & ~(size_m)15)
+			#define muma_concurrent_buffer_size(type_size, capacity) (MUMA_CONCURRENT_BUFFER_DATA_OFFSET + (type_size)*(capacity))
+
+			#define mu_concurrent_array_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					void* buffer; \
+					size_m length; \
+				}; typedef struct struct_name struct_name; \
+				\
+				struct struct_name##_snapshot { \
+					const type* data; \
+					size_m length; \
+					size_m epoch; \
+				}; typedef struct struct_name##_snapshot struct_name##_snapshot;
+
+			#define mu_concurrent_array_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length); \
+				linkage void function_name_prefix##destroy(mumaResult* result, struct_name* s); \
+				linkage void function_name_prefix##reserve(mumaResult* result, struct_name* s, size_m allocated_length); \
+				linkage void function_name_prefix##push(mumaResult* result, struct_name* s, type value); \
+				linkage struct_name##_snapshot function_name_prefix##read_begin(struct_name* s); \
+				linkage void function_name_prefix##read_end(struct_name##_snapshot snapshot);
+
+			#define mu_concurrent_array_definitions(struct_name, type, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty concurrent array, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Room for `allocated_length` elements is allocated up front. Note that `allocated_length` being 0 is valid, and nothing will be immediately allocated. @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name s = MU_ZERO_STRUCT(struct_name); \
+					s.buffer = MU_NULL_PTR; \
+					s.length = 0; \
+					\
+					if (allocated_length == 0) { \
+						return s; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					mumaConcurrentBuffer* buffer = (mumaConcurrentBuffer*)muma_malloc(&res, muma_concurrent_buffer_size(sizeof(type), allocated_length)); \
+					if (buffer == 0) { \
+						MU_SET_RESULT(result, res) \
+						return s; \
+					} \
+					\
+					buffer->allocated_length = allocated_length; \
+					s.buffer = buffer; \
+					return s; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a concurrent array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##destroy(mumaResult* result, struct_name* s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The buffer is retired rather than freed, so snapshots that are still being read stay valid; no new snapshots may be taken after this is called. `s` is left empty. If no readers are active, the buffer is freed right away; otherwise, it stays allocated (and counted against its memory budget) until `muma_epoch_reclaim` or `muma_epoch_synchronize` is called after the readers are done, so callers that need the memory back should call `muma_epoch_synchronize`. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##destroy(mumaResult* result, struct_name* s) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaConcurrentBuffer* buffer = (mumaConcurrentBuffer*)MUMA_ATOMIC_EXCHANGE_PTR(&s->buffer, MU_NULL_PTR); \
+					if (buffer != MU_NULL_PTR) { \
+						muma_epoch_retire(&buffer->node, muma_concurrent_buffer_size(sizeof(type), buffer->allocated_length)); \
+						/* Without active readers, two more advances free it */ \
+						if (muma_epoch_reclaim()) { \
+							muma_epoch_reclaim(); \
+						} \
+					} \
+					MUMA_ATOMIC_STORE_RELEASE(&s->length, 0); \
+				} \
+				\
+				/*@DOCBEGIN #### Reserve @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##reserve` is used to make sure that a concurrent array can hold a certain amount of elements without growing, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##reserve(mumaResult* result, struct_name* s, size_m allocated_length) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN If the array needs to grow, its elements are copied into a new buffer, which is then published, and the old buffer is retired. This function may only be called by the writer. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##reserve(mumaResult* result, struct_name* s, size_m allocated_length) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaConcurrentBuffer* old_buffer = (mumaConcurrentBuffer*)(void*)MUMA_ATOMIC_LOAD(&s->buffer); \
+					size_m old_allocated_length = (old_buffer == MU_NULL_PTR) ? 0 : old_buffer->allocated_length; \
+					if (allocated_length <= old_allocated_length) { \
+						return; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					mumaConcurrentBuffer* buffer = (mumaConcurrentBuffer*)muma_malloc(&res, muma_concurrent_buffer_size(sizeof(type), allocated_length)); \
+					if (buffer == 0) { \
+						MU_SET_RESULT(result, res) \
+						return; \
+					} \
+					\
+					buffer->allocated_length = allocated_length; \
+					if (old_buffer != MU_NULL_PTR) { \
+						mu_memcpy(((muByte*)buffer) + MUMA_CONCURRENT_BUFFER_DATA_OFFSET, ((muByte*)old_buffer) + MUMA_CONCURRENT_BUFFER_DATA_OFFSET, sizeof(type)*MUMA_ATOMIC_LOAD(&s->length)); \
+					} \
+					\
+					/* Publish the new buffer before retiring the old one, so */ \
+					/* that readers of a later epoch can't still see it. */ \
+					(void)MUMA_ATOMIC_EXCHANGE_PTR(&s->buffer, (void*)buffer); \
+					if (old_buffer != MU_NULL_PTR) { \
+						muma_epoch_retire(&old_buffer->node, muma_concurrent_buffer_size(sizeof(type), old_allocated_length)); \
+					} \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element onto the end of a concurrent array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##push(mumaResult* result, struct_name* s, type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The element is written before the length is increased, so readers never see an element that hasn't been written yet. The allocated length doubles whenever the array is full. This function may only be called by the writer. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##push(mumaResult* result, struct_name* s, type value) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					mumaConcurrentBuffer* buffer = (mumaConcurrentBuffer*)(void*)MUMA_ATOMIC_LOAD(&s->buffer); \
+					size_m length = MUMA_ATOMIC_LOAD(&s->length); \
+					if (buffer == MU_NULL_PTR || length == buffer->allocated_length) { \
+						mumaResult res = MUMA_SUCCESS; \
+						function_name_prefix##reserve(&res, s, (buffer == MU_NULL_PTR) ? 8 : buffer->allocated_length*2); \
+						if (res != MUMA_SUCCESS) { \
+							MU_SET_RESULT(result, res) \
+							return; \
+						} \
+						buffer = (mumaConcurrentBuffer*)(void*)MUMA_ATOMIC_LOAD(&s->buffer); \
+					} \
+					\
+					((type*)(((muByte*)buffer) + MUMA_CONCURRENT_BUFFER_DATA_OFFSET))[length] = value; \
+					MUMA_ATOMIC_ADD_FETCH(&s->length, 1); \
+				} \
+				\
+				/*@DOCBEGIN #### Read begin @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##read_begin` is used to take a snapshot of a concurrent array for reading, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name##_snapshot function_name_prefix##read_begin(struct_name* s) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN This function enters an epoch (see `muma_epoch_enter`), meaning that the buffer it returns isn't freed until the snapshot is ended with `function_name_prefix##read_end`. Elements pushed after the snapshot was taken may or may not be included in it. Snapshots should be short-lived, since retired buffers can't be freed while one is held. @NEWLINE @DOCEND */ \
+				linkage struct_name##_snapshot function_name_prefix##read_begin(struct_name* s) { \
+					struct_name##_snapshot snapshot = MU_ZERO_STRUCT(struct_name##_snapshot); \
+					snapshot.epoch = muma_epoch_enter(); \
+					\
+					/* The buffer is loaded before the length; if the buffer */ \
+					/* grew in between, the old one holds every element up to */ \
+					/* its capacity. */ \
+					mumaConcurrentBuffer* buffer = (mumaConcurrentBuffer*)(void*)MUMA_ATOMIC_LOAD(&s->buffer); \
+					size_m length = MUMA_ATOMIC_LOAD(&s->length); \
+					if (buffer == MU_NULL_PTR) { \
+						snapshot.data = MU_NULL_PTR; \
+						snapshot.length = 0; \
+						return snapshot; \
+					} \
+					\
+					snapshot.data = (const type*)(((muByte*)buffer) + MUMA_CONCURRENT_BUFFER_DATA_OFFSET); \
+					snapshot.length = (length < buffer->allocated_length) ? length : buffer->allocated_length; \
+					return snapshot; \
+				} \
+				\
+				/*@DOCBEGIN #### Read end @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##read_end` is used to end a snapshot of a concurrent array, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##read_end(struct_name##_snapshot snapshot) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN After this is called, `snapshot.data` may no longer be read. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##read_end(struct_name##_snapshot snapshot) { \
+					muma_epoch_exit(snapshot.epoch); \
+				}
+
+			#define mu_concurrent_array_declaration(struct_name, type, function_name_prefix) \
+				mu_concurrent_array_struct(struct_name, type) \
+				mu_concurrent_array_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_concurrent_array_header(struct_name, type, function_name_prefix) \
+				mu_concurrent_array_struct(struct_name, type) \
+				mu_concurrent_array_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_concurrent_array_impl(struct_name, type, function_name_prefix) \
+				mu_concurrent_array_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_concurrent_array_static_declaration(struct_name, type, function_name_prefix) \
+				mu_concurrent_array_struct(struct_name, type) \
+				mu_concurrent_array_definitions(struct_name, type, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## SPSC ring
+
+			/* @DOCBEGIN
+
+			The macro `mu_spsc_ring_declaration` is a macro function that is used to create a single-producer/single-consumer ring, which is a fixed-capacity queue that one thread (the "producer") pushes onto and one other thread (the "consumer") pops from at the same time, without any locks. Its parameters look like this:
+
+			```c
+			mu_spsc_ring_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`struct_name` is the desired name of the ring struct that will be created for the given type.
+
+			`type` is the type that will be used to represent an element in the ring.
+
+			`function_name_prefix` is the prefix that will be used for the function names (for example, `function_name_prefix##create`).
+
+			### Struct
+
+			The ring expands to do a few things. The first thing it does is create a struct for the ring, following this expansion:
+
+			```c
+			struct struct_name {
+				type* data;
+				size_m capacity;
+				muByte padding0[MUMA_CACHE_LINE_SIZE];
+				size_m head;
+				size_m cached_tail;
+				muByte padding1[MUMA_CACHE_LINE_SIZE];
+				size_m tail;
+				size_m cached_head;
+				muByte padding2[MUMA_CACHE_LINE_SIZE];
+			}; typedef struct struct_name struct_name;
+			```
+
+			`data` holds `capacity` elements, `capacity` always being a power of 2. `head` is the index of the next element to pop (only written by the consumer), and `tail` is the index of the next element to push (only written by the producer); both only ever increase, and are wrapped into `data` by masking. The padding keeps the consumer's and producer's indices on different cache lines, so that they don't bounce a single line between the two threads.
+
+			`cached_tail` is the consumer's last known value of `tail`, and `cached_head` is the producer's last known value of `head`; each side only reads the other side's index when its cached copy says that the ring is empty or full, which avoids most of the traffic between the two threads' caches.
+
+			`MUMA_CACHE_LINE_SIZE` is 64 by default, and can be overridden by defining it before the inclusion of the header.
+
+			Since both threads need to see the same struct, a ring is used through a pointer once it is created; the struct shouldn't be copied after it has started being used.
+
+			Note that these members aren't meant to be modified by the user.
+
+			### Linkage
+
+			Like with dynamic arrays, `mu_spsc_ring_declaration` defines its functions with external linkage, so it can only be expanded in one translation unit. The following macros take the same parameters, and split the declaration in the same way as described in the dynamic array's linkage section:
+
+			```c
+			mu_spsc_ring_header(struct_name, type, function_name_prefix)
+			mu_spsc_ring_impl(struct_name, type, function_name_prefix)
+			mu_spsc_ring_static_declaration(struct_name, type, function_name_prefix)
+			```
+
+			`mu_spsc_ring_header` defines the struct and declares the functions, `mu_spsc_ring_impl` defines the functions in the one translation unit that owns them, and `mu_spsc_ring_static_declaration` defines everything as `static inline`, which lets a producer or consumer loop inline `function_name_prefix##push` and `function_name_prefix##pop`. They are built on `mu_spsc_ring_struct(struct_name, type)`, `mu_spsc_ring_prototypes(struct_name, type, function_name_prefix, linkage)`, and `mu_spsc_ring_definitions(struct_name, type, function_name_prefix, linkage)`.
+
+			### Functions
+
+			After the struct is defined, functions are also defined to interface with and use this struct. The following is a list of all of those functions.
+
+			@DOCEND */
+
+			#ifndef MUMA_CACHE_LINE_SIZE
+				#define MUMA_CACHE_LINE_SIZE 64
+			#endif
+
+			#define mu_spsc_ring_struct(struct_name, type) \
+				\
+				struct struct_name { \
+					type* data; \
+					size_m capacity; \
+					muByte padding0[MUMA_CACHE_LINE_SIZE]; \
+					size_m head; \
+					size_m cached_tail; \
+					muByte padding1[MUMA_CACHE_LINE_SIZE]; \
+					size_m tail; \
+					size_m cached_head; \
+					muByte padding2[MUMA_CACHE_LINE_SIZE]; \
+				}; typedef struct struct_name struct_name;
+
+			#define mu_spsc_ring_prototypes(struct_name, type, function_name_prefix, linkage) \
+				\
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m capacity); \
+				linkage void function_name_prefix##destroy(mumaResult* result, struct_name* r); \
+				linkage muBool function_name_prefix##push(struct_name* r, type value); \
+				linkage muBool function_name_prefix##pop(struct_name* r, type* p_value); \
+				linkage size_m function_name_prefix##push_n(struct_name* r, const type* values, size_m count); \
+				linkage size_m function_name_prefix##pop_n(struct_name* r, type* values, size_m count); \
+				linkage size_m function_name_prefix##length(struct_name* r);
+
+			#define mu_spsc_ring_definitions(struct_name, type, function_name_prefix, linkage) \
+				\
+				/*@DOCBEGIN #### Creation @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN The function `function_name_prefix##create` is used to create an empty ring, defined below: @NEWLINE @DOCEND*/ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN struct_name function_name_prefix##create(mumaResult* result, size_m capacity) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `capacity` is rounded up to a power of 2 (and to at least 2). @NEWLINE @DOCEND */ \
+				linkage struct_name function_name_prefix##create(mumaResult* result, size_m capacity) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					struct_name r = MU_ZERO_STRUCT(struct_name); \
+					r.data = MU_NULL_PTR; \
+					r.capacity = 0; \
+					r.head = r.cached_tail = 0; \
+					r.tail = r.cached_head = 0; \
+					\
+					size_m rounded = 2; \
+					while (rounded < capacity) { \
+						rounded *= 2; \
+					} \
+					\
+					mumaResult res = MUMA_SUCCESS; \
+					r.data = (type*)muma_malloc(&res, sizeof(type)*rounded); \
+					if (r.data == 0) { \
+						MU_SET_RESULT(result, res) \
+						return r; \
+					} \
+					r.capacity = rounded; \
+					return r; \
+				} \
+				\
+				/*@DOCBEGIN #### Destruction @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##destroy` is used to destroy a ring, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN void function_name_prefix##destroy(mumaResult* result, struct_name* r) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Neither the producer nor the consumer may use the ring while or after it is destroyed. @NEWLINE @DOCEND */ \
+				linkage void function_name_prefix##destroy(mumaResult* result, struct_name* r) { \
+					MU_SET_RESULT(result, MUMA_SUCCESS) \
+					\
+					if (r->data != MU_NULL_PTR) { \
+						muma_free(r->data, sizeof(type)*r->capacity); \
+					} \
+					r->data = MU_NULL_PTR; \
+					r->capacity = 0; \
+					r->head = r->cached_tail = 0; \
+					r->tail = r->cached_head = 0; \
+				} \
+				\
+				/*@DOCBEGIN #### Push @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push` is used to push an element onto a ring, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##push(struct_name* r, type value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN `MU_FALSE` is returned if the ring is full. This function may only be called by the producer. @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##push(struct_name* r, type value) { \
+					size_m tail = r->tail; \
+					if (tail - r->cached_head == r->capacity) { \
+						r->cached_head = MUMA_ATOMIC_LOAD_ACQUIRE(&r->head); \
+						if (tail - r->cached_head == r->capacity) { \
+							return MU_FALSE; \
+						} \
+					} \
+					\
+					r->data[tail & (r->capacity-1)] = value; \
+					MUMA_ATOMIC_STORE_RELEASE(&r->tail, tail+1); \
+					return MU_TRUE; \
+				} \
+				\
+				/*@DOCBEGIN #### Pop @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop` is used to pop the oldest element from a ring, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN muBool function_name_prefix##pop(struct_name* r, type* p_value) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The element is written to `*p_value`. `MU_FALSE` is returned if the ring is empty. This function may only be called by the consumer. @NEWLINE @DOCEND */ \
+				linkage muBool function_name_prefix##pop(struct_name* r, type* p_value) { \
+					size_m head = r->head; \
+					if (head == r->cached_tail) { \
+						r->cached_tail = MUMA_ATOMIC_LOAD_ACQUIRE(&r->tail); \
+						if (head == r->cached_tail) { \
+							return MU_FALSE; \
+						} \
+					} \
+					\
+					*p_value = r->data[head & (r->capacity-1)]; \
+					MUMA_ATOMIC_STORE_RELEASE(&r->head, head+1); \
+					return MU_TRUE; \
+				} \
+				\
+				/*@DOCBEGIN #### Push n @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##push_n` is used to push several elements onto a ring at once, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##push_n(struct_name* r, const type* values, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN As many of the `count` elements as fit are pushed (in order), and the amount pushed is returned. The elements are copied with at most two `mu_memcpy` calls (one if they don't wrap around the end of `data`), and are published to the consumer all at once. This function may only be called by the producer. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##push_n(struct_name* r, const type* values, size_m count) { \
+					size_m tail = r->tail; \
+					size_m space = r->capacity - (tail - r->cached_head); \
+					if (space < count) { \
+						r->cached_head = MUMA_ATOMIC_LOAD_ACQUIRE(&r->head); \
+						space = r->capacity - (tail - r->cached_head); \
+						count = (count < space) ? count : space; \
+						if (count == 0) { \
+							return 0; \
+						} \
+					} \
+					\
+					size_m index = tail & (r->capacity-1); \
+					size_m first = r->capacity - index; \
+					first = (count < first) ? count : first; \
+					mu_memcpy(&r->data[index], values, sizeof(type)*first); \
+					if (first < count) { \
+						mu_memcpy(r->data, &values[first], sizeof(type)*(count-first)); \
+					} \
+					MUMA_ATOMIC_STORE_RELEASE(&r->tail, tail+count); \
+					return count; \
+				} \
+				\
+				/*@DOCBEGIN #### Pop n @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##pop_n` is used to pop several elements from a ring at once, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##pop_n(struct_name* r, type* values, size_m count) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Up to `count` of the oldest elements are popped into `values` (oldest first), and the amount popped is returned. Like `function_name_prefix##push_n`, the elements are copied with at most two `mu_memcpy` calls. This function may only be called by the consumer. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##pop_n(struct_name* r, type* values, size_m count) { \
+					size_m head = r->head; \
+					size_m available = r->cached_tail - head; \
+					if (available < count) { \
+						r->cached_tail = MUMA_ATOMIC_LOAD_ACQUIRE(&r->tail); \
+						available = r->cached_tail - head; \
+						count = (count < available) ? count : available; \
+						if (count == 0) { \
+							return 0; \
+						} \
+					} \
+					\
+					size_m index = head & (r->capacity-1); \
+					size_m first = r->capacity - index; \
+					first = (count < first) ? count : first; \
+					mu_memcpy(values, &r->data[index], sizeof(type)*first); \
+					if (first < count) { \
+						mu_memcpy(&values[first], r->data, sizeof(type)*(count-first)); \
+					} \
+					MUMA_ATOMIC_STORE_RELEASE(&r->head, head+count); \
+					return count; \
+				} \
+				\
+				/*@DOCBEGIN #### Length @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN The function `function_name_prefix##length` returns the amount of elements in a ring, defined below: @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ```c @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN size_m function_name_prefix##length(struct_name* r) @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN ``` @NEWLINE @DOCEND */ \
+				/*@DOCBEGIN Note that, if the other thread is using the ring at the same time, the amount may already be out of date by the time it's returned. @NEWLINE @DOCEND */ \
+				linkage size_m function_name_prefix##length(struct_name* r) { \
+					size_m head = MUMA_ATOMIC_LOAD_ACQUIRE(&r->head); \
+					size_m tail = MUMA_ATOMIC_LOAD_ACQUIRE(&r->tail); \
+					return tail - head; \
+				}
+
+			#define mu_spsc_ring_declaration(struct_name, type, function_name_prefix) \
+				mu_spsc_ring_struct(struct_name, type) \
+				mu_spsc_ring_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_spsc_ring_header(struct_name, type, function_name_prefix) \
+				mu_spsc_ring_struct(struct_name, type) \
+				mu_spsc_ring_prototypes(struct_name, type, function_name_prefix, )
+
+			#define mu_spsc_ring_impl(struct_name, type, function_name_prefix) \
+				mu_spsc_ring_definitions(struct_name, type, function_name_prefix, )
+
+			#define mu_spsc_ring_static_declaration(struct_name, type, function_name_prefix) \
+				mu_spsc_ring_struct(struct_name, type) \
+				mu_spsc_ring_definitions(struct_name, type, function_name_prefix, static MUMA_INLINE)
+
+		// @DOCLINE ## Version
+
+			// @DOCLINE There are three major, minor, and patch macros respectively defined to represent the version of mum, defined as `MUMA_VERSION_MAJOR`, `MUMA_VERSION_MINOR`, and `MUMA_VERSION_PATCH`, following the formatting of `vMAJOR.MINOR.PATCH`.
+
+			#define MUMA_VERSION_MAJOR 1
+			#define MUMA_VERSION_MINOR 1
+			#define MUMA_VERSION_PATCH 0
+
+	// @DOCLINE # Functions
+
+		// @DOCLINE ## Memory budget functions
+
+			// @DOCLINE The function `muma_global_budget` returns a pointer to the global memory budget, defined below: @NLNT
+			MUDEF mumaBudget* muma_global_budget(void);
+
+			// @DOCLINE The function `muma_budget_create` is used to create a memory budget, defined below: @NLNT
+			MUDEF mumaBudget muma_budget_create(size_m soft_limit, size_m hard_limit, mumaBudgetCallback callback, void* user_data, mumaBudget* parent);
+
+			// @DOCLINE If `parent` is 0, the global budget is used as the parent, so that all memory stays counted against the global budget. Note that the returned budget must stay at the same address for as long as memory is acquired from it.
+
+			// @DOCLINE The function `muma_budget_set_limits` is used to change the limits and callback of a memory budget, defined below: @NLNT
+			MUDEF void muma_budget_set_limits(mumaBudget* budget, size_m soft_limit, size_m hard_limit, mumaBudgetCallback callback, void* user_data);
+
+			// @DOCLINE Note that lowering a limit below the current usage doesn't free anything; it just causes further allocations to be refused. Note that, for every budget function, passing 0 for `budget` refers to the global budget.
+
+			// @DOCLINE The function `muma_budget_get_usage` returns the amount of bytes currently acquired from a memory budget, defined below: @NLNT
+			MUDEF size_m muma_budget_get_usage(mumaBudget* budget);
+
+			// @DOCLINE The function `muma_budget_acquire` is used to acquire bytes from a memory budget and all of its parents, defined below: @NLNT
+			MUDEF mumaResult muma_budget_acquire(mumaBudget* budget, size_m size);
+
+			// @DOCLINE If any budget in the chain would exceed its hard limit, nothing is acquired from any of them and `MUMA_BUDGET_EXCEEDED` is returned.
+
+			// @DOCLINE The function `muma_budget_release` is used to release bytes previously acquired from a memory budget and all of its parents, defined below: @NLNT
+			MUDEF void muma_budget_release(mumaBudget* budget, size_m size);
+
+		// @DOCLINE ## Allocation functions
+
+			// @DOCLINE muma allocates all of its memory through the following functions, which count memory against the budget of the calling thread's allocator, and then allocate it with the calling thread's allocator (which is `mu_malloc`, `mu_realloc`, and `mu_free` by default). Because of this, overriding these dependencies only affects muma if it is done in the file that defines `MUMA_IMPLEMENTATION`.
+
+			// @DOCLINE The function `muma_malloc` is used to allocate memory, defined below: @NLNT
+			MUDEF void* muma_malloc(mumaResult* result, size_m size);
+
+			// @DOCLINE The function `muma_realloc` is used to reallocate memory previously allocated with `muma_malloc` or `muma_realloc`, defined below: @NLNT
+			MUDEF void* muma_realloc(mumaResult* result, void* p, size_m old_size, size_m new_size);
+
+			// @DOCLINE Note that, like `realloc`, if this function fails, 0 is returned and `p` is left untouched.
+
+			// @DOCLINE The function `muma_free` is used to free memory previously allocated with `muma_malloc` or `muma_realloc`, defined below: @NLNT
+			MUDEF void muma_free(void* p, size_m size);
+
+			// @DOCLINE Note that `size` must be the same size that the memory was (re)allocated with.
+
+			// @DOCLINE The function `muma_allocator_malloc` is equivalent to `muma_malloc`, but allocates with `allocator` rather than the calling thread's allocator, defined below: @NLNT
+			MUDEF void* muma_allocator_malloc(mumaResult* result, const mumaAllocator* allocator, size_m size);
+
+			// @DOCLINE The function `muma_allocator_realloc` is equivalent to `muma_realloc`, but reallocates with `allocator`, defined below: @NLNT
+			MUDEF void* muma_allocator_realloc(mumaResult* result, const mumaAllocator* allocator, void* p, size_m old_size, size_m new_size);
+
+			// @DOCLINE The function `muma_allocator_free` is equivalent to `muma_free`, but frees with `allocator`, defined below: @NLNT
+			MUDEF void muma_allocator_free(const mumaAllocator* allocator, void* p, size_m size);
+
+			// @DOCLINE These allow memory to be handed between threads with different allocators: if the allocator that some memory was allocated with is kept (see `muma_get_allocator`), any thread can reallocate or free it through that allocator, which also releases it from that allocator's budget.
+
+		// @DOCLINE ## Allocator functions
+
+			// @DOCLINE The function `muma_set_allocator` is used to set the allocator used by muma on the calling thread, defined below: @NLNT
+			MUDEF mumaAllocator muma_set_allocator(const mumaAllocator* allocator);
+
+			// @DOCLINE The previous allocator is returned, so that it can be restored later. If `allocator` is 0, the calling thread goes back to using `mu_malloc`, `mu_realloc`, and `mu_free` (which is represented by an allocator whose members are all 0).
+
+			// @DOCLINE The allocator is stored in a thread-local variable if the compiler supports it (and in a global variable if it doesn't). Note that memory has to be reallocated and freed with the same allocator that it was allocated with; for example, a dynamic array created while a thread's allocator was set must be destroyed while it is still set. Shared arrays and concurrent arrays are the exception, since their buffers record the allocator that they were allocated with: they can be handed to threads using any allocator, and are always freed through (and released from the budget of) the allocator that allocated them. Note that muma's parallel functions only allocate on the thread that called them.
+
+			// @DOCLINE The function `muma_get_allocator` returns the allocator used by muma on the calling thread, defined below: @NLNT
+			MUDEF mumaAllocator muma_get_allocator(void);
+
+		// @DOCLINE ## TLSF functions
+
+			// @DOCLINE The function `muma_tlsf_create` is used to create a TLSF allocator over a region of memory, defined below: @NLNT
+			MUDEF mumaTLSF* muma_tlsf_create(void* memory, size_m size);
+
+			// @DOCLINE The allocator's bookkeeping is stored at the start of the region, and a pointer to it is returned; if the region is too small to hold the bookkeeping and at least one block, 0 is returned. The region must stay valid for as long as the allocator is used, and nothing needs to be done to destroy the allocator other than no longer using it.
+
+			// @DOCLINE The function `muma_tlsf_malloc` is used to allocate memory from a TLSF allocator, defined below: @NLNT
+			MUDEF void* muma_tlsf_malloc(mumaTLSF* tlsf, size_m size);
+
+			// @DOCLINE If there isn't a large enough free block, 0 is returned.
+
+			// @DOCLINE The function `muma_tlsf_realloc` is used to reallocate memory from a TLSF allocator, defined below: @NLNT
+			MUDEF void* muma_tlsf_realloc(mumaTLSF* tlsf, void* p, size_m size);
+
+			// @DOCLINE Shrinking is always done in place, and growing is done in place if the block after `p` is free and large enough; otherwise, a new block is allocated and the contents are copied over. Like `realloc`, if `p` is 0, this is equivalent to `muma_tlsf_malloc`, and if this function fails, 0 is returned and `p` is left untouched.
+
+			// @DOCLINE The function `muma_tlsf_free` is used to free memory from a TLSF allocator, defined below: @NLNT
+			MUDEF void muma_tlsf_free(mumaTLSF* tlsf, void* p);
+
+			// @DOCLINE The function `muma_tlsf_block_size` returns the amount of bytes usable in a block allocated from a TLSF allocator, defined below: @NLNT
+			MUDEF size_m muma_tlsf_block_size(void* p);
+
+			// @DOCLINE The function `muma_tlsf_allocator` returns an allocator that allocates from a TLSF allocator, defined below: @NLNT
+			MUDEF mumaAllocator muma_tlsf_allocator(mumaTLSF* tlsf);
+
+			// @DOCLINE For example, a real-time thread could make all of its dynamic arrays use a TLSF allocator like so:
+
+			/* @DOCBEGIN
+			```c
+			static unsigned char region[1 << 20];
+			mumaTLSF* tlsf = muma_tlsf_create(region, sizeof(region));
+			mumaAllocator allocator = muma_tlsf_allocator(tlsf);
+			mumaAllocator previous = muma_set_allocator(&allocator);
+			// ... create, use, and destroy dynamic arrays ...
+			muma_set_allocator(&previous);
+			```
+			@DOCEND */
+
+		// @DOCLINE ## Buddy functions
+
+			// @DOCLINE The function `muma_buddy_create` is used to create a buddy allocator over a region of memory, defined below: @NLNT
+			MUDEF mumaBuddy* muma_buddy_create(void* memory, size_m size, size_m min_block);
+
+			// @DOCLINE `min_block` is the size of the smallest block, which is rounded up to a power of 2 that is at least 16 (meaning that 0 can be passed to get the smallest possible). Larger minimum blocks waste more memory on small allocations, but need a smaller table: the allocator's bookkeeping, which is stored at the start of the region, takes up a byte per minimum-sized block.
+
+			// @DOCLINE If the region isn't large enough to hold the bookkeeping and at least one block, 0 is returned. If the region isn't a power of 2 times `min_block` large, it is split up into several top-level blocks. The region must stay valid for as long as the allocator is used, and nothing needs to be done to destroy the allocator other than no longer using it.
+
+			// @DOCLINE The function `muma_buddy_malloc` is used to allocate memory from a buddy allocator, defined below: @NLNT
+			MUDEF void* muma_buddy_malloc(mumaBuddy* buddy, size_m size);
+
+			// @DOCLINE If there isn't a large enough free block, 0 is returned.
+
+			// @DOCLINE The function `muma_buddy_realloc` is used to reallocate memory from a buddy allocator, defined below: @NLNT
+			MUDEF void* muma_buddy_realloc(mumaBuddy* buddy, void* p, size_m old_size, size_m new_size);
+
+			// @DOCLINE Shrinking is always done in place, and growing is done in place if the block's buddies up to the new size are free; otherwise, a new block is allocated and the contents are copied over. Like `realloc`, if `p` is 0, this is equivalent to `muma_buddy_malloc`, and if this function fails, 0 is returned and `p` is left untouched.
+
+			// @DOCLINE The function `muma_buddy_free` is used to free memory from a buddy allocator, defined below: @NLNT
+			MUDEF void muma_buddy_free(mumaBuddy* buddy, void* p, size_m size);
+
+			// @DOCLINE Note that, for both `muma_buddy_realloc` and `muma_buddy_free`, the given size of `p` must be the size it was (re)allocated with.
+
+			// @DOCLINE The function `muma_buddy_get_stats` returns statistics about a buddy allocator, defined below: @NLNT
+			MUDEF mumaBuddyStats muma_buddy_get_stats(mumaBuddy* buddy);
+
+			// @DOCLINE The function `muma_buddy_allocator` returns an allocator that allocates from a buddy allocator, defined below: @NLNT
+			MUDEF mumaAllocator muma_buddy_allocator(mumaBuddy* buddy);
+
+		// @DOCLINE ## Caching allocator functions
+
+			// @DOCLINE The function `muma_caching_create` is used to create a caching allocator, defined below: @NLNT
+			MUDEF mumaCachingAllocator* muma_caching_create(mumaResult* result);
+
+			// @DOCLINE The function `muma_caching_destroy` is used to destroy a caching allocator and free all of its memory, defined below: @NLNT
+			MUDEF void muma_caching_destroy(mumaCachingAllocator* caching);
+
+			// @DOCLINE Note that no thread may use the allocator while or after it is destroyed, and that allocations larger than `MUMA_CACHING_MAX_SIZE` that are still alive aren't freed.
+
+			// @DOCLINE The function `muma_caching_malloc` is used to allocate memory from a caching allocator, defined below: @NLNT
+			MUDEF void* muma_caching_malloc(mumaCachingAllocator* caching, size_m size);
+
+			// @DOCLINE The function `muma_caching_realloc` is used to reallocate memory from a caching allocator, defined below: @NLNT
+			MUDEF void* muma_caching_realloc(mumaCachingAllocator* caching, void* p, size_m old_size, size_m new_size);
+
+			// @DOCLINE If the old and new size are in the same size class, `p` is returned as is. Like `realloc`, if `p` is 0, this is equivalent to `muma_caching_malloc`, and if this function fails, 0 is returned and `p` is left untouched.
+
+			// @DOCLINE The function `muma_caching_free` is used to free memory from a caching allocator, defined below: @NLNT
+			MUDEF void muma_caching_free(mumaCachingAllocator* caching, void* p, size_m size);
+
+			// @DOCLINE Note that, for both `muma_caching_realloc` and `muma_caching_free`, the given size of `p` must be the size it was (re)allocated with, since that is how its size class is found.
+
+			// @DOCLINE The function `muma_caching_flush` is used to give every block in the calling thread's cache back to the central pool of a caching allocator, defined below: @NLNT
+			MUDEF void muma_caching_flush(mumaCachingAllocator* caching);
+
+			// @DOCLINE The function `muma_caching_allocator` returns an allocator that allocates from a caching allocator, defined below: @NLNT
+			MUDEF mumaAllocator muma_caching_allocator(mumaCachingAllocator* caching);
+
+			// @DOCLINE Since the allocator set by `muma_set_allocator` is per thread, every thread that should use the caching allocator needs to set it.
+
+		// @DOCLINE ## String builder functions
+
+			// @DOCLINE muma provides a string builder, which is a growable `char` buffer specialized for appending text (such as when writing logs or JSON). Appending only checks whether or not there's room, growing by doubling if there isn't, and integers and floats are formatted straight into the buffer without going through `snprintf`.
+
+			// @DOCLINE The struct `mumaStringBuilder` represents a string builder, defined below: @NLNT
+			struct mumaStringBuilder {
+				// @DOCLINE `@NLFT`: the string built so far, which is always NUL-terminated (even when nothing has been allocated yet).
+				char* data;
+				// @DOCLINE `@NLFT`: the length of the string, not counting the NUL terminator.
+				size_m length;
+				// @DOCLINE `@NLFT`: the size of the allocation holding `data` (0 if nothing has been allocated).
+				size_m allocated_length;
+			}; typedef struct mumaStringBuilder mumaStringBuilder;
+
+			// @DOCLINE Note that the members aren't meant to be modified by the user, only read.
+
+			// @DOCLINE The function `muma_string_builder_create` is used to create a string builder, defined below: @NLNT
+			MUDEF mumaStringBuilder muma_string_builder_create(mumaResult* result, size_m allocated_length);
+
+			// @DOCLINE Room for a string of `allocated_length` characters (plus its NUL terminator) is allocated up front; `allocated_length` being 0 is valid, and nothing will be immediately allocated.
+
+			// @DOCLINE The function `muma_string_builder_destroy` is used to destroy a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_destroy(mumaStringBuilder* builder);
+
+			// @DOCLINE The function `muma_string_builder_reserve` is used to make sure that a string builder has room for a string of at least a certain length, defined below: @NLNT
+			MUDEF void muma_string_builder_reserve(mumaResult* result, mumaStringBuilder* builder, size_m length);
+
+			// @DOCLINE The function `muma_string_builder_clear` is used to empty a string builder, keeping its allocation, defined below: @NLNT
+			MUDEF void muma_string_builder_clear(mumaStringBuilder* builder);
+
+			// @DOCLINE The function `muma_string_builder_append` is used to append bytes to a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_append(mumaResult* result, mumaStringBuilder* builder, const void* data, size_m size);
+
+			// @DOCLINE The function `muma_string_builder_append_cstr` is used to append a NUL-terminated string to a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_append_cstr(mumaResult* result, mumaStringBuilder* builder, const char* cstr);
+
+			// @DOCLINE The function `muma_string_builder_append_char` is used to append a single character to a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_append_char(mumaResult* result, mumaStringBuilder* builder, char c);
+
+			// @DOCLINE The function `muma_string_builder_append_uint` is used to append an unsigned integer in decimal to a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_append_uint(mumaResult* result, mumaStringBuilder* builder, uint64_m value);
+
+			// @DOCLINE The function `muma_string_builder_append_int` is used to append a signed integer in decimal to a string builder, defined below: @NLNT
+			MUDEF void muma_string_builder_append_int(mumaResult* result, mumaStringBuilder* builder, int64_m value);
+
+			// @DOCLINE Both integer functions write two digits at a time from a lookup table, directly into the buffer.
+
+			// @DOCLINE The function `muma_string_builder_append_double` is used to append a floating-point number to a string builder with a fixed amount of digits after the decimal point, defined below: @NLNT
+			MUDEF void muma_string_builder_append_double(mumaResult* result, mumaStringBuilder* builder, double value, size_m decimals);
+
+			// @DOCLINE `decimals` is capped at 9. The value is rounded to the nearest multiple of `10^-decimals`, and printed like `printf`'s `%.*f` would (for example, `-1.50` for -1.5 with 2 decimals). Values at or above 10^19 are printed in scientific notation instead (like `%.*e`), and NaN and infinities are printed as `nan`, `inf`, and `-inf`. The digits are computed exactly from the binary value, and ties are rounded to even like `printf` does (for example, 2.5 with 0 decimals is printed as `2`, and 0.125 with 2 decimals as `0.12`); only the digits of values printed in scientific notation can differ from `printf`'s in the last place, since they are scaled down with floating-point division.
+
+			// @DOCLINE The function `muma_string_builder_finish` is used to take ownership of a string builder's string without copying it, defined below: @NLNT
+			MUDEF char* muma_string_builder_finish(mumaResult* result, mumaStringBuilder* builder, size_m* allocated_length);
+
+			// @DOCLINE The returned string is NUL-terminated, and must be freed with `muma_free`, passing the size written to `allocated_length`. The builder is left empty (and can be reused). If nothing has been allocated yet, a 1-byte empty string is allocated; if that fails, 0 is returned.
+
+		// @DOCLINE ## I/O functions
+
+			// @DOCLINE muma provides a few functions to read and write raw bytes on a file descriptor (such as a file or socket), which are meant to be used to fill and drain arrays without an intermediate buffer. They are implemented with `read`, `readv`, `write`, and `writev` on Unix, and with `_read` and `_write` on Windows (where file descriptors are those of the C runtime, not sockets). If a call is interrupted by a signal, it is retried.
+
+			// @DOCLINE The struct `mumaIOVec` represents a contiguous range of bytes to read into or write from, defined below: @NLNT
+			struct mumaIOVec { void* data; size_m size; }; typedef struct mumaIOVec mumaIOVec;
+
+			// @DOCLINE The function `muma_read` is used to read up to `size` bytes from a file descriptor into `data`, defined below: @NLNT
+			MUDEF size_m muma_read(mumaResult* result, int fd, void* data, size_m size);
+
+			// @DOCLINE The amount of bytes read is returned, with 0 meaning end-of-file (or an error, in which case `MUMA_IO_FAILED` is the result). Like `read`, less bytes than requested can be read.
+
+			// @DOCLINE The function `muma_readv` is used to read into several ranges of bytes in a single call, defined below: @NLNT
+			MUDEF size_m muma_readv(mumaResult* result, int fd, mumaIOVec* vecs, size_m count);
+
+			// @DOCLINE The ranges are filled in order, and the total amount of bytes read is returned. Note that a single call only reads into up to 64 ranges at once.
+
+			// @DOCLINE The function `muma_write` is used to write `size` bytes from `data` to a file descriptor, defined below: @NLNT
+			MUDEF size_m muma_write(mumaResult* result, int fd, const void* data, size_m size);
+
+			// @DOCLINE Unlike `write`, this function keeps writing until every byte has been written, and returns the amount of bytes written, which is only less than `size` if the function fails.
+
+			// @DOCLINE The function `muma_writev` is used to write several ranges of bytes, defined below: @NLNT
+			MUDEF size_m muma_writev(mumaResult* result, int fd, mumaIOVec* vecs, size_m count);
+
+			// @DOCLINE Like `muma_write`, this function keeps writing until every byte of every range has been written.
+
+		// @DOCLINE ## Thread functions
+
+			// @DOCLINE muma uses threads for some functions (such as parallel sorting), which are created with pthreads on Unix and with the Win32 API on Windows. Note that, on some Unix systems, this means that the program needs to be linked with `-pthread`; defining `MUMA_NO_THREADS` before the inclusion of the implementation turns off all thread usage, running everything on the calling thread instead.
+
+			// @DOCLINE The type `mumaTaskFunc` is the type of a task ran by `muma_parallel_run`, defined below: @NLNT
+			typedef void (*mumaTaskFunc)(void* user_data, size_m index);
+
+			// @DOCLINE The function `muma_parallel_run` is used to run a task several times in parallel, defined below: @NLNT
+			MUDEF void muma_parallel_run(size_m count, mumaTaskFunc func, void* user_data);
+
+			// @DOCLINE This function calls `func(user_data, i)` for every `i` less than `count`, each on its own thread (with the calling thread running index 0), and returns once all of them have finished. If a thread can't be created, its index is run on the calling thread instead, so every index is always run exactly once.
+
+			// @DOCLINE The function `muma_thread_count` returns the amount of hardware threads available, defined below: @NLNT
+			MUDEF size_m muma_thread_count(void);
+
+		// @DOCLINE ## Deferred freeing functions
+
+			// @DOCLINE Freeing a very large allocation can take a long time (for example, unmapping hundreds of megabytes of pages), which stalls whichever thread happens to destroy the array that owns it. To avoid this, muma can hand frees above a size threshold to a background thread instead, which is turned off by default.
+
+			// @DOCLINE Deferred frees are pushed onto a lock-free queue (stored in the freed memory itself, so deferring never allocates), and the background thread frees them with `mu_free` in the order it gets to them. This applies to `muma_free` and to `muma_realloc` when it shrinks an allocation from above the threshold to below it (in which case the remaining contents are copied to a new allocation, and the old one is freed in the background). Only frees made with the default allocator (see `muma_set_allocator`) are deferred.
+
+			// @DOCLINE Note that deferred memory stays counted against its memory budget until it is actually freed.
+
+			// @DOCLINE The function `muma_deferred_free_start` is used to start deferring frees of at least `threshold` bytes to a background thread, defined below: @NLNT
+			MUDEF void muma_deferred_free_start(mumaResult* result, size_m threshold);
+
+			// @DOCLINE If it has already been started, the threshold is just changed. If the background thread can't be created, `MUMA_THREAD_FAILED` is the result, and frees keep happening right away.
+
+			// @DOCLINE The function `muma_deferred_free_flush` is used to wait until every deferred free so far has been performed, defined below: @NLNT
+			MUDEF void muma_deferred_free_flush(void);
+
+			// @DOCLINE The calling thread helps free whatever is still queued, so this doesn't depend on the background thread catching up.
+
+			// @DOCLINE The function `muma_deferred_free_stop` is used to stop deferring frees, defined below: @NLNT
+			MUDEF void muma_deferred_free_stop(void);
+
+			// @DOCLINE Every queued free is performed, and the background thread exits before this function returns. Note that this function (and `muma_deferred_free_start`) shouldn't be called while another thread is in the middle of freeing memory through muma; it is meant for startup and shutdown.
+
+			// @DOCLINE The struct `mumaDeferredFreeStats` holds statistics about deferred freeing, defined below: @NLNT
+			struct mumaDeferredFreeStats {
+				// @DOCLINE `@NLFT`: the amount of frees currently waiting to be performed (the depth of the queue).
+				size_m pending_count;
+				// @DOCLINE `@NLFT`: the amount of bytes currently waiting to be freed.
+				size_m pending_bytes;
+				// @DOCLINE `@NLFT`: the total amount of frees that have been deferred.
+				size_m deferred_count;
+				// @DOCLINE `@NLFT`: the total amount of bytes whose freeing has been deferred.
+				size_m deferred_bytes;
+			}; typedef struct mumaDeferredFreeStats mumaDeferredFreeStats;
+
+			// @DOCLINE The function `muma_deferred_free_get_stats` returns the current statistics about deferred freeing, defined below: @NLNT
+			MUDEF mumaDeferredFreeStats muma_deferred_free_get_stats(void);
+
+		// @DOCLINE ## Epoch functions
+
+			// @DOCLINE muma provides epoch-based reclamation for memory that other threads may still be reading when it's no longer needed (used by concurrent arrays). Readers enter an epoch before reading shared memory and exit it once they're done; memory that has been unpublished is retired instead of freed, and only freed once every reader that could have seen it has exited its epoch.
+
+			// @DOCLINE Retired memory is kept in two lists (one per epoch parity), and the global epoch only advances once no reader is left in the epoch before the current one, at which point everything retired in that epoch is freed. Entering and exiting an epoch is an atomic increment and decrement, so readers never wait on the writer.
+
+			// @DOCLINE The function `muma_epoch_enter` is used to enter the current epoch before reading shared memory, defined below: @NLNT
+			MUDEF size_m muma_epoch_enter(void);
+
+			// @DOCLINE The returned token must be passed to `muma_epoch_exit` once the reader is done. Epochs can be entered several times at once (including by the same thread).
+
+			// @DOCLINE The function `muma_epoch_exit` is used to exit an epoch entered with `muma_epoch_enter`, defined below: @NLNT
+			MUDEF void muma_epoch_exit(size_m epoch);
+
+			// @DOCLINE The function `muma_epoch_retire` is used to free memory once no reader can be reading it anymore, defined below: @NLNT
+			MUDEF void muma_epoch_retire(mumaEpochNode* node, size_m size);
+
+			// @DOCLINE `node` must be at the start of an allocation of `size` bytes made with `muma_malloc` using the calling thread's current allocator (see `muma_set_allocator`), which must already be unreachable for readers that enter an epoch from now on. That allocator is recorded in `node`, and whichever thread reclaims the memory frees it through the recorded allocator and releases it from the recorded allocator's budget, not its own. This function also tries to reclaim memory (see `muma_epoch_reclaim`).
+
+			// @DOCLINE The function `muma_epoch_reclaim` is used to try to free retired memory without waiting, defined below: @NLNT
+			MUDEF muBool muma_epoch_reclaim(void);
+
+			// @DOCLINE This function returns whether or not the epoch was advanced; if readers are still in the previous epoch, nothing happens.
+
+			// @DOCLINE The function `muma_epoch_synchronize` is used to wait until all memory retired so far has been freed, defined below: @NLNT
+			MUDEF void muma_epoch_synchronize(void);
+
+			// @DOCLINE Note that this waits on every reader currently in an epoch, so it must not be called while the calling thread is in one itself.
+
+		// @DOCLINE ## Name function
+
+			#ifdef MUMA_NAMES
+				// @DOCLINE The function `muma_result_get_name` is used to get a `const char*` representation of a `mumaResult` value, defined below: @NLNT
+				MUDEF const char* muma_result_get_name(mumaResult result);
+				// @DOCLINE Note that this function is only defined if the macro `MUMA_NAMES` is defined.
+			#endif
+
+	#ifdef __cplusplus
+		}
+	#endif
+
+	// @DOCLINE # C++ wrapper
+
+		/* @DOCBEGIN
+
+		When compiled as C++11 or above, muma also defines the class template `muma::dynamic_array`, a dynamic array that owns its memory, and that is safe to use with types that have constructors, destructors, and non-trivial copy/move behavior (which the macro-generated functions are not, as they move elements around with `mu_realloc`, `mu_memmove`, and `mu_memset`). It is declared like so:
+
+		```cpp
+		namespace muma {
+			template<typename T, typename Policy = muma::default_policy>
+			class dynamic_array;
+		}
+		```
+
+		A `muma::dynamic_array` can be moved but not copied, and frees its elements and memory once destroyed. Its interface mirrors `std::vector` (`size`, `capacity`, `data`, `operator[]`, `begin`, `end`, `reserve`, `resize`, `push_back`, `emplace_back`, `pop_back`, `insert`, `emplace`, `erase`, `clear`, `shrink_to_fit`), except that every function that can allocate returns a `mumaResult` instead of throwing; if it isn't `MUMA_SUCCESS`, the array is left untouched.
+
+		Memory is allocated through `muma_malloc`, `muma_realloc`, and `muma_free`, so it is counted against the budget of the calling thread's allocator (see `muma_set_allocator`), and through that budget's parents, against the global memory budget. For types where `muma::is_trivially_relocatable<T>::value` is true, the array grows with `muma_realloc` and moves elements with `mu_memmove`, exactly like the macro-generated dynamic arrays. For every other type, elements are move-constructed into a new allocation and then destroyed; note that the move constructor and move assignment of such types are expected not to throw.
+
+		`muma::is_trivially_relocatable<T>` defaults to `std::is_trivially_copyable<T>`, and can be specialized to be true for types that can safely be moved around in memory as raw bytes (such as most types that hold an owning pointer).
+
+		`Policy` decides how the capacity grows, and must have a static member function `size_m grow(size_m capacity, size_m required)` that returns a capacity at least `required`. `muma::default_policy` doubles the capacity until it fits, starting from exactly `required` elements, like the macro-generated dynamic arrays.
+
+		Note that the element type's alignment can't be greater than the alignment of memory returned by `mu_malloc`.
+
+		Note that this wrapper can be excluded by defining `MUMA_NO_CPP_WRAPPER` before the inclusion of the header.
+
+		@DOCEND */
+
+	#if defined(__cplusplus) && !defined(MUMA_NO_CPP_WRAPPER) && \
+		(__cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L))
+
+		#include <new>
+		#include <utility>
+		#include <type_traits>
+		#include <cstddef>
+
+		namespace muma {
+
+			template<typename T>
+			struct is_trivially_relocatable : std::integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+
+			struct default_policy {
+				static size_m grow(size_m capacity, size_m required) {
+					if (capacity == 0) {
+						return required;
+					}
+					while (capacity < required) {
+						capacity *= 2;
+					}
+					return capacity;
+				}
+			};
+
+			template<typename T, typename Policy = default_policy>
+			class dynamic_array {
+				static_assert(alignof(T) <= alignof(std::max_align_t), "muma::dynamic_array doesn't support over-aligned types");
+
+				typedef is_trivially_relocatable<T> relocatable;
+
+				T* m_data;
+				size_m m_allocated_length;
+				size_m m_length;
+
+				// Moves the array into an allocation of exactly `allocated_length`
+				// elements, which must be at least `m_length`
+				mumaResult reallocate(size_m allocated_length) {
+					if (allocated_length == m_allocated_length) {
+						return MUMA_SUCCESS;
+					}
+
+					mumaResult res = MUMA_SUCCESS;
+					if (allocated_length == 0) {
+						muma_free(m_data, sizeof(T)*m_allocated_length);
+						m_data = MU_NULL_PTR;
+						m_allocated_length = 0;
+						return res;
+					}
+
+					T* data;
+					if (relocatable::value || m_data == MU_NULL_PTR) {
+						if (m_data == MU_NULL_PTR) {
+							data = (T*)muma_malloc(&res, sizeof(T)*allocated_length);
+						} else {
+							data = (T*)muma_realloc(&res, m_data, sizeof(T)*m_allocated_length, sizeof(T)*allocated_length);
+						}
+						if (data == MU_NULL_PTR) {
+							return res;
+						}
+					} else {
+						data = (T*)muma_malloc(&res, sizeof(T)*allocated_length);
+						if (data == MU_NULL_PTR) {
+							return res;
+						}
+						for (size_m i = 0; i < m_length; i++) {
+							::new ((void*)&data[i]) T(std::move(m_data[i]));
+							m_data[i].~T();
+						}
+						muma_free(m_data, sizeof(T)*m_allocated_length);
+					}
+
+					m_data = data;
+					m_allocated_length = allocated_length;
+					return res;
+				}
+
+				// Makes room for at least `length` elements following the policy
+				mumaResult grow(size_m length) {
+					if (length <= m_allocated_length) {
+						return MUMA_SUCCESS;
+					}
+					return reallocate(Policy::grow(m_allocated_length, length));
+				}
+
+				void destroy_range(size_m begin, size_m end) {
+					if (!std::is_trivially_destructible<T>::value) {
+						for (size_m i = begin; i < end; i++) {
+							m_data[i].~T();
+						}
+					}
+				}
+
+			public:
+				typedef T value_type;
+				typedef T* iterator;
+				typedef const T* const_iterator;
+
+				dynamic_array() : m_data(MU_NULL_PTR), m_allocated_length(0), m_length(0) {}
+
+				~dynamic_array() {
+					clear();
+					reallocate(0);
+				}
+
+				dynamic_array(dynamic_array&& other) : m_data(other.m_data), m_allocated_length(other.m_allocated_length), m_length(other.m_length) {
+					other.m_data = MU_NULL_PTR;
+					other.m_allocated_length = 0;
+					other.m_length = 0;
+				}
+
+				dynamic_array& operator=(dynamic_array&& other) {
+					if (this != &other) {
+						clear();
+						reallocate(0);
+						m_data = other.m_data;
+						m_allocated_length = other.m_allocated_length;
+						m_length = other.m_length;
+						other.m_data = MU_NULL_PTR;
+						other.m_allocated_length = 0;
+						other.m_length = 0;
+					}
+					return *this;
+				}
+
+				dynamic_array(const dynamic_array&) = delete;
+				dynamic_array& operator=(const dynamic_array&) = delete;
+
+				T* data() { return m_data; }
+				const T* data() const { return m_data; }
+				size_m size() const { return m_length; }
+				size_m capacity() const { return m_allocated_length; }
+				bool empty() const { return m_length == 0; }
+
+				T& operator[](size_m index) { return m_data[index]; }
+				const T& operator[](size_m index) const { return m_data[index]; }
+				T& back() { return m_data[m_length-1]; }
+				const T& back() const { return m_data[m_length-1]; }
+
+				iterator begin() { return m_data; }
+				iterator end() { return m_data + m_length; }
+				const_iterator begin() const { return m_data; }
+				const_iterator end() const { return m_data + m_length; }
+
+				mumaResult reserve(size_m allocated_length) {
+					if (allocated_length <= m_allocated_length) {
+						return MUMA_SUCCESS;
+					}
+					return reallocate(allocated_length);
+				}
+
+				mumaResult shrink_to_fit() {
+					return reallocate(m_length);
+				}
+
+				template<typename... Args>
+				mumaResult emplace_back(Args&&... args) {
+					if (m_length == m_allocated_length) {
+						// The arguments may refer to an element of this array, so
+						// the new element is built before the array is moved.
+						T value(std::forward<Args>(args)...);
+						mumaResult res = grow(m_length+1);
+						if (res != MUMA_SUCCESS) {
+							return res;
+						}
+						::new ((void*)&m_data[m_length]) T(std::move(value));
+					} else {
+						::new ((void*)&m_data[m_length]) T(std::forward<Args>(args)...);
+					}
+					m_length++;
+					return MUMA_SUCCESS;
+				}
+
+				mumaResult push_back(const T& value) { return emplace_back(value); }
+				mumaResult push_back(T&& value) { return emplace_back(std::move(value)); }
+
+				void pop_back() {
+					m_length--;
+					destroy_range(m_length, m_length+1);
+				}
+
+				template<typename... Args>
+				mumaResult emplace(size_m index, Args&&... args) {
+					if (index > m_length) {
+						return MUMA_INVALID_INDEX;
+					}
+					if (index == m_length) {
+						return emplace_back(std::forward<Args>(args)...);
+					}
+
+					T value(std::forward<Args>(args)...);
+					mumaResult res = grow(m_length+1);
+					if (res != MUMA_SUCCESS) {
+						return res;
+					}
+
+					if (relocatable::value) {
+						mu_memmove((void*)&m_data[index+1], (void*)&m_data[index], sizeof(T)*(m_length-index));
+						::new ((void*)&m_data[index]) T(std::move(value));
+					} else {
+						::new ((void*)&m_data[m_length]) T(std::move(m_data[m_length-1]));
+						for (size_m i = m_length-1; i > index; i--) {
+							m_data[i] = std::move(m_data[i-1]);
+						}
+						m_data[index] = std::move(value);
+					}
+					m_length++;
+					return MUMA_SUCCESS;
+				}
+
+				mumaResult insert(size_m index, const T& value) { return emplace(index, value); }
+				mumaResult insert(size_m index, T&& value) { return emplace(index, std::move(value)); }
+
+				mumaResult erase(size_m index) {
+					if (index >= m_length) {
+						return MUMA_INVALID_INDEX;
+					}
+
+					if (relocatable::value) {
+						destroy_range(index, index+1);
+						mu_memmove((void*)&m_data[index], (void*)&m_data[index+1], sizeof(T)*((m_length-1)-index));
+					} else {
+						for (size_m i = index; i+1 < m_length; i++) {
+							m_data[i] = std::move(m_data[i+1]);
+						}
+						destroy_range(m_length-1, m_length);
+					}
+					m_length--;
+					return MUMA_SUCCESS;
+				}
+
+				// New elements are value-initialized
+				mumaResult resize(size_m length) {
+					if (length < m_length) {
+						destroy_range(length, m_length);
+						m_length = length;
+						return MUMA_SUCCESS;
+					}
+
+					mumaResult res = grow(length);
+					if (res != MUMA_SUCCESS) {
+						return res;
+					}
+					for (; m_length < length; m_length++) {
+						::new ((void*)&m_data[m_length]) T();
+					}
+					return MUMA_SUCCESS;
+				}
+
+				void clear() {
+					destroy_range(0, m_length);
+					m_length = 0;
+				}
+			};
+
+		}
+
+	#endif
+
+#endif /* MUMA_H */
+
+#ifdef MUMA_IMPLEMENTATION
+
+	/* muUtility version 1.0.0 implementation */
+
+		#ifndef MUU_IMPLEMENTATION
+			#define MUU_IMPLEMENTATION
+
+			#ifdef MUU_IMPLEMENTATION
+	
+				// ...
+
+			#endif /* MUU_IMPLEMENTATION */
+		#endif
+
+	#ifdef __cplusplus
+		extern "C" {
+	#endif
+
+	/* Memory budgets */
+
+		// Zero-initialized, so it has no limits
+		static mumaBudget muma_inner_global_budget;
+
+		MUDEF mumaBudget* muma_global_budget(void) {
+			return &muma_inner_global_budget;
+		}
+
+		MUDEF mumaBudget muma_budget_create(size_m soft_limit, size_m hard_limit, mumaBudgetCallback callback, void* user_data, mumaBudget* parent) {
+			mumaBudget b = MU_ZERO_STRUCT(mumaBudget);
+			b.usage = 0;
+			b.soft_limit = soft_limit;
+			b.hard_limit = hard_limit;
+			b.callback = callback;
+			b.user_data = user_data;
+			b.parent = (parent != MU_NULL_PTR) ? parent : &muma_inner_global_budget;
+			return b;
+		}
+
+		MUDEF void muma_budget_set_limits(mumaBudget* budget, size_m soft_limit, size_m hard_limit, mumaBudgetCallback callback, void* user_data) {
+			if (budget == MU_NULL_PTR) {
+				budget = &muma_inner_global_budget;
+			}
+
+			budget->soft_limit = soft_limit;
+			budget->hard_limit = hard_limit;
+			budget->callback = callback;
+			budget->user_data = user_data;
+		}
+
+		MUDEF size_m muma_budget_get_usage(mumaBudget* budget) {
+			if (budget == MU_NULL_PTR) {
+				budget = &muma_inner_global_budget;
+			}
+
+			return MUMA_ATOMIC_LOAD(&budget->usage);
+		}
+
+		// Acquires from a single budget, ignoring its parents
+		static mumaResult muma_inner_budget_acquire_single(mumaBudget* b, size_m size) {
+			size_m usage = MUMA_ATOMIC_ADD_FETCH(&b->usage, size);
+
+			if (b->hard_limit != 0 && usage > b->hard_limit) {
+				MUMA_ATOMIC_SUB_FETCH(&b->usage, size);
+				if (b->callback == MU_NULL_PTR) {
+					return MUMA_BUDGET_EXCEEDED;
+				}
+
+				// Give the callback a chance to free memory, then retry once
+				b->callback(b, usage-size, size, b->user_data);
+				usage = MUMA_ATOMIC_ADD_FETCH(&b->usage, size);
+				if (usage > b->hard_limit) {
+					MUMA_ATOMIC_SUB_FETCH(&b->usage, size);
+					return MUMA_BUDGET_EXCEEDED;
+				}
+				return MUMA_SUCCESS;
+			}
+
+			if (b->soft_limit != 0 && b->callback != MU_NULL_PTR && usage > b->soft_limit && usage-size <= b->soft_limit) {
+				b->callback(b, usage, size, b->user_data);
+			}
+
+			return MUMA_SUCCESS;
+		}
+
+		MUDEF mumaResult muma_budget_acquire(mumaBudget* budget, size_m size) {
+			if (budget == MU_NULL_PTR) {
+				budget = &muma_inner_global_budget;
+			}
+			if (size == 0) {
+				return MUMA_SUCCESS;
+			}
+
+			for (mumaBudget* b = budget; b != MU_NULL_PTR; b = b->parent) {
+				mumaResult res = muma_inner_budget_acquire_single(b, size);
+				if (res != MUMA_SUCCESS) {
+					// Roll back whatever was acquired before this budget
+					for (mumaBudget* r = budget; r != b; r = r->parent) {
+						MUMA_ATOMIC_SUB_FETCH(&r->usage, size);
+					}
+					return res;
+				}
+			}
+
+			return MUMA_SUCCESS;
+		}
+
+		MUDEF void muma_budget_release(mumaBudget* budget, size_m size) {
+			if (budget == MU_NULL_PTR) {
+				budget = &muma_inner_global_budget;
+			}
+			if (size == 0) {
+				return;
+			}
+
+			for (mumaBudget* b = budget; b != MU_NULL_PTR; b = b->parent) {
+				MUMA_ATOMIC_SUB_FETCH(&b->usage, size);
+			}
+		}
+
+	/* Allocation */
+
+		// `MUMA_THREAD_LOCAL` makes a variable thread-local, if the
+		// compiler supports it. It can be overridden by defining it
+		// before the inclusion of the implementation.
+		#ifndef MUMA_THREAD_LOCAL
+			#if defined(__cplusplus) && __cplusplus >= 201103L
+				#define MUMA_THREAD_LOCAL thread_local
+			#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+				#define MUMA_THREAD_LOCAL _Thread_local
+			#elif defined(__GNUC__) || defined(__clang__)
+				#define MUMA_THREAD_LOCAL __thread
+			#elif defined(_MSC_VER)
+				#define MUMA_THREAD_LOCAL __declspec(thread)
+			#else
+				#define MUMA_THREAD_LOCAL
+			#endif
+		#endif
+
+		// The calling thread's allocator; all 0 means mu_malloc & co.
+		static MUMA_THREAD_LOCAL mumaAllocator muma_inner_allocator;
+
+		MUDEF mumaAllocator muma_set_allocator(const mumaAllocator* allocator) {
+			mumaAllocator previous = muma_inner_allocator;
+			if (allocator == MU_NULL_PTR) {
+				muma_inner_allocator.allocate = MU_NULL_PTR;
+				muma_inner_allocator.reallocate = MU_NULL_PTR;
+				muma_inner_allocator.deallocate = MU_NULL_PTR;
+				muma_inner_allocator.user_data = MU_NULL_PTR;
+				muma_inner_allocator.budget = MU_NULL_PTR;
+			} else {
+				muma_inner_allocator = *allocator;
+			}
+			return previous;
+		}
+
+		MUDEF mumaAllocator muma_get_allocator(void) {
+			return muma_inner_allocator;
+		}
+
+		// Deferred freeing (defined further below, after threads); a
+		// threshold of 0 means that frees aren't being deferred.
+		static size_m muma_inner_deferred_threshold = 0;
+		static muBool muma_inner_deferred_push(void* p, size_m size, mumaBudget* budget);
+
+		MUDEF void* muma_allocator_malloc(mumaResult* result, const mumaAllocator* allocator, size_m size) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			mumaBudget* budget = allocator->budget;
+			mumaResult res = muma_budget_acquire(budget, size);
+			if (res != MUMA_SUCCESS) {
+				MU_SET_RESULT(result, res)
+				return MU_NULL_PTR;
+			}
+
+			void* p = (allocator->allocate != MU_NULL_PTR)
+				? allocator->allocate(allocator->user_data, size)
+				: mu_malloc(size);
+			if (p == MU_NULL_PTR) {
+				muma_budget_release(budget, size);
+				MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE)
+				return MU_NULL_PTR;
+			}
+
+			return p;
+		}
+
+		MUDEF void* muma_allocator_realloc(mumaResult* result, const mumaAllocator* allocator, void* p, size_m old_size, size_m new_size) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			if (p == MU_NULL_PTR) {
+				return muma_allocator_malloc(result, allocator, new_size);
+			}
+
+			mumaBudget* budget = allocator->budget;
+
+			// Growth is acquired before reallocating so that it can be
+			// refused; shrinking is only released once it succeeded.
+			if (new_size > old_size) {
+				mumaResult res = muma_budget_acquire(budget, new_size-old_size);
+				if (res != MUMA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return MU_NULL_PTR;
+				}
+			}
+
+			// Shrinking from above the deferred freeing threshold to below
+			// it moves the contents, and the old memory is freed in the
+			// background.
+			size_m threshold = MUMA_ATOMIC_LOAD(&muma_inner_deferred_threshold);
+			if (threshold != 0 && old_size >= threshold && new_size < threshold && allocator->reallocate == MU_NULL_PTR) {
+				if (muma_budget_acquire(budget, new_size) == MUMA_SUCCESS) {
+					void* moved = mu_malloc(new_size);
+					if (moved != MU_NULL_PTR) {
+						mu_memcpy(moved, p, new_size);
+						if (muma_inner_deferred_push(p, old_size, budget)) {
+							return moved;
+						}
+						mu_free(moved);
+					}
+					muma_budget_release(budget, new_size);
+				}
+			}
+
+			void* new_p = (allocator->reallocate != MU_NULL_PTR)
+				? allocator->reallocate(allocator->user_data, p, old_size, new_size)
+				: mu_realloc(p, new_size);
+			if (new_p == MU_NULL_PTR) {
+				if (new_size > old_size) {
+					muma_budget_release(budget, new_size-old_size);
+				}
+				MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE)
+				return MU_NULL_PTR;
+			}
+
+			if (new_size < old_size) {
+				muma_budget_release(budget, old_size-new_size);
+			}
+			return new_p;
+		}
+
+		MUDEF void muma_allocator_free(const mumaAllocator* allocator, void* p, size_m size) {
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+
+			mumaBudget* budget = allocator->budget;
+			if (allocator->deallocate != MU_NULL_PTR) {
+				allocator->deallocate(allocator->user_data, p, size);
+			} else {
+				// Large frees may be handed to the background thread, which
+				// releases the budget itself once the memory is freed.
+				size_m threshold = MUMA_ATOMIC_LOAD(&muma_inner_deferred_threshold);
+				if (threshold != 0 && size >= threshold && muma_inner_deferred_push(p, size, budget)) {
+					return;
+				}
+				mu_free(p);
+			}
+			muma_budget_release(budget, size);
+		}
+
+		MUDEF void* muma_malloc(mumaResult* result, size_m size) {
+			return muma_allocator_malloc(result, &muma_inner_allocator, size);
+		}
+
+		MUDEF void* muma_realloc(mumaResult* result, void* p, size_m old_size, size_m new_size) {
+			return muma_allocator_realloc(result, &muma_inner_allocator, p, old_size, new_size);
+		}
+
+		MUDEF void muma_free(void* p, size_m size) {
+			muma_allocator_free(&muma_inner_allocator, p, size);
+		}
+
+	/* TLSF allocator */
+
+		// Header at the start of every block; the block's memory comes
+		// right after it. `size` is the size of the block's memory, with
+		// the lowest two bits used as flags.
+		struct mumaTLSFBlock {
+			// The block right before this one in memory (0 for the first)
+			mumaTLSFBlock* prev_phys;
+			size_m size;
+		};
+
+		// Links of a free block, stored in the block's memory
+		struct mumaInnerTLSFLinks {
+			mumaTLSFBlock* next;
+			mumaTLSFBlock* prev;
+		}; typedef struct mumaInnerTLSFLinks mumaInnerTLSFLinks;
+
+		#define MUMA_TLSF_BLOCK_FREE ((size_m)1)
+		#define MUMA_TLSF_PREV_FREE ((size_m)2)
+		#define MUMA_TLSF_FLAGS (MUMA_TLSF_BLOCK_FREE | MUMA_TLSF_PREV_FREE)
+
+		#define MUMA_TLSF_ROUND_UP(n) (((n) + (MUMA_TLSF_ALIGN-1)) & ~(size_m)(MUMA_TLSF_ALIGN-1))
+		#define MUMA_TLSF_HEADER MUMA_TLSF_ROUND_UP(sizeof(mumaTLSFBlock))
+		#define MUMA_TLSF_BLOCK_MIN MUMA_TLSF_ROUND_UP(sizeof(mumaInnerTLSFLinks))
+		#define MUMA_TLSF_BLOCK_MAX ((size_m)0xFFFFFFFF & ~(size_m)(MUMA_TLSF_ALIGN-1))
+
+		#define muma_inner_tlsf_size(b) ((b)->size & ~MUMA_TLSF_FLAGS)
+		#define muma_inner_tlsf_data(b) ((void*)(((muByte*)(b)) + MUMA_TLSF_HEADER))
+		#define muma_inner_tlsf_from_data(p) ((mumaTLSFBlock*)(((muByte*)(p)) - MUMA_TLSF_HEADER))
+		#define muma_inner_tlsf_links(b) ((mumaInnerTLSFLinks*)muma_inner_tlsf_data(b))
+		#define muma_inner_tlsf_next(b) ((mumaTLSFBlock*)(((muByte*)(b)) + MUMA_TLSF_HEADER + muma_inner_tlsf_size(b)))
+
+		// Index of the highest set bit (x must not be 0)
+		static MUMA_INLINE size_m muma_inner_fls(size_m x) {
+			#if defined(__GNUC__) || defined(__clang__)
+				return (size_m)(63 - __builtin_clzll((unsigned long long)x));
+			#else
+				size_m n = 0;
+				while (x >>= 1) {
+					n++;
+				}
+				return n;
+			#endif
+		}
+
+		// Lists that a free block of the given size belongs in
+		static MUMA_INLINE void muma_inner_tlsf_mapping(size_m size, size_m* fl, size_m* sl) {
+			if (size < ((size_m)1 << MUMA_TLSF_FL_SHIFT)) {
+				*fl = 0;
+				*sl = size >> MUMA_TLSF_ALIGN_LOG2;
+				return;
+			}
+			size_m f = muma_inner_fls(size);
+			*sl = (size >> (f - MUMA_TLSF_SL_LOG2)) ^ ((size_m)1 << MUMA_TLSF_SL_LOG2);
+			*fl = f - (MUMA_TLSF_FL_SHIFT - 1);
+		}
+
+		static void muma_inner_tlsf_insert(mumaTLSF* tlsf, mumaTLSFBlock* b) {
+			size_m fl, sl;
+			muma_inner_tlsf_mapping(muma_inner_tlsf_size(b), &fl, &sl);
+
+			mumaTLSFBlock* head = tlsf->blocks[fl][sl];
+			muma_inner_tlsf_links(b)->next = head;
+			muma_inner_tlsf_links(b)->prev = MU_NULL_PTR;
+			if (head != MU_NULL_PTR) {
+				muma_inner_tlsf_links(head)->prev = b;
+			}
+			tlsf->blocks[fl][sl] = b;
+			tlsf->fl_bitmap |= (uint32_m)1 << fl;
+			tlsf->sl_bitmap[fl] |= (uint32_m)1 << sl;
+		}
+
+		static void muma_inner_tlsf_remove(mumaTLSF* tlsf, mumaTLSFBlock* b) {
+			size_m fl, sl;
+			muma_inner_tlsf_mapping(muma_inner_tlsf_size(b), &fl, &sl);
+
+			mumaInnerTLSFLinks* links = muma_inner_tlsf_links(b);
+			if (links->next != MU_NULL_PTR) {
+				muma_inner_tlsf_links(links->next)->prev = links->prev;
+			}
+			if (links->prev != MU_NULL_PTR) {
+				muma_inner_tlsf_links(links->prev)->next = links->next;
+				return;
+			}
+
+			tlsf->blocks[fl][sl] = links->next;
+			if (links->next == MU_NULL_PTR) {
+				tlsf->sl_bitmap[fl] &= ~((uint32_m)1 << sl);
+				if (tlsf->sl_bitmap[fl] == 0) {
+					tlsf->fl_bitmap &= ~((uint32_m)1 << fl);
+				}
+			}
+		}
+
+		// Finds (and removes) a free block of at least `size` bytes
+		static mumaTLSFBlock* muma_inner_tlsf_find(mumaTLSF* tlsf, size_m size) {
+			// Round up to the next list so that any block in it is large enough
+			if (size >= ((size_m)1 << MUMA_TLSF_FL_SHIFT)) {
+				size_m round = ((size_m)1 << (muma_inner_fls(size) - MUMA_TLSF_SL_LOG2)) - 1;
+				if (size > MUMA_TLSF_BLOCK_MAX - round) {
+					return MU_NULL_PTR;
+				}
+				size += round;
+			}
+			size_m fl, sl;
+			muma_inner_tlsf_mapping(size, &fl, &sl);
+			if (fl >= MUMA_TLSF_FL_COUNT) {
+				return MU_NULL_PTR;
+			}
+
+			uint32_m sl_map = tlsf->sl_bitmap[fl] & ((~(uint32_m)0) << sl);
+			if (sl_map == 0) {
+				uint32_m fl_map = (fl+1 < 32) ? (tlsf->fl_bitmap & ((~(uint32_m)0) << (fl+1))) : 0;
+				if (fl_map == 0) {
+					return MU_NULL_PTR;
+				}
+				fl = MUMA_CTZ64(fl_map);
+				sl_map = tlsf->sl_bitmap[fl];
+			}
+			sl = MUMA_CTZ64(sl_map);
+
+			mumaTLSFBlock* b = tlsf->blocks[fl][sl];
+			muma_inner_tlsf_remove(tlsf, b);
+			return b;
+		}
+
+		// Marks a block as used or free, updating the flag of the block after it
+		static MUMA_INLINE void muma_inner_tlsf_mark(mumaTLSFBlock* b, muBool free) {
+			mumaTLSFBlock* next = muma_inner_tlsf_next(b);
+			if (free) {
+				b->size |= MUMA_TLSF_BLOCK_FREE;
+				next->size |= MUMA_TLSF_PREV_FREE;
+			} else {
+				b->size &= ~MUMA_TLSF_BLOCK_FREE;
+				next->size &= ~MUMA_TLSF_PREV_FREE;
+			}
+		}
+
+		// Splits the end of a used block off into a free block if it is
+		// large enough to hold one
+		static void muma_inner_tlsf_trim(mumaTLSF* tlsf, mumaTLSFBlock* b, size_m size) {
+			size_m b_size = muma_inner_tlsf_size(b);
+			if (b_size < size + MUMA_TLSF_HEADER + MUMA_TLSF_BLOCK_MIN) {
+				return;
+			}
+
+			mumaTLSFBlock* rest = (mumaTLSFBlock*)(((muByte*)muma_inner_tlsf_data(b)) + size);
+			rest->prev_phys = b;
+			rest->size = b_size - size - MUMA_TLSF_HEADER;
+			b->size = size | (b->size & MUMA_TLSF_FLAGS);
+			muma_inner_tlsf_next(rest)->prev_phys = rest;
+
+			// The rest could be next to a free block, so it's freed normally
+			// (which also takes it out of the usage)
+			muma_tlsf_free(tlsf, muma_inner_tlsf_data(rest));
+		}
+
+		// Size of the block used for a request of `size` bytes, or 0 if it
+		// is too large
+		static MUMA_INLINE size_m muma_inner_tlsf_adjust(size_m size) {
+			if (size > MUMA_TLSF_BLOCK_MAX) {
+				return 0;
+			}
+			size = MUMA_TLSF_ROUND_UP(size);
+			return (size < MUMA_TLSF_BLOCK_MIN) ? MUMA_TLSF_BLOCK_MIN : size;
+		}
+
+		MUDEF mumaTLSF* muma_tlsf_create(void* memory, size_m size) {
+			// Align the start of the region
+			size_m pad = (MUMA_TLSF_ALIGN - ((size_m)memory & (MUMA_TLSF_ALIGN-1))) & (MUMA_TLSF_ALIGN-1);
+			size_m overhead = pad + MUMA_TLSF_ROUND_UP(sizeof(mumaTLSF)) + MUMA_TLSF_HEADER*2;
+			if (memory == MU_NULL_PTR || size < overhead + MUMA_TLSF_BLOCK_MIN) {
+				return MU_NULL_PTR;
+			}
+
+			mumaTLSF* tlsf = (mumaTLSF*)(((muByte*)memory) + pad);
+			mu_memset(tlsf, 0, sizeof(mumaTLSF));
+
+			size_m block_size = (size - overhead) & ~(size_m)(MUMA_TLSF_ALIGN-1);
+			if (block_size > MUMA_TLSF_BLOCK_MAX) {
+				block_size = MUMA_TLSF_BLOCK_MAX;
+			}
+
+			// One free block covering the region, followed by a used
+			// sentinel block of size 0 so that the last block has a next
+			mumaTLSFBlock* b = (mumaTLSFBlock*)(((muByte*)tlsf) + MUMA_TLSF_ROUND_UP(sizeof(mumaTLSF)));
+			b->prev_phys = MU_NULL_PTR;
+			b->size = block_size | MUMA_TLSF_BLOCK_FREE;
+			mumaTLSFBlock* sentinel = muma_inner_tlsf_next(b);
+			sentinel->prev_phys = b;
+			sentinel->size = MUMA_TLSF_PREV_FREE;
+			muma_inner_tlsf_insert(tlsf, b);
+
+			tlsf->size = block_size + MUMA_TLSF_HEADER;
+			return tlsf;
+		}
+
+		MUDEF void* muma_tlsf_malloc(mumaTLSF* tlsf, size_m size) {
+			size = muma_inner_tlsf_adjust(size);
+			if (size == 0) {
+				return MU_NULL_PTR;
+			}
+
+			mumaTLSFBlock* b = muma_inner_tlsf_find(tlsf, size);
+			if (b == MU_NULL_PTR) {
+				return MU_NULL_PTR;
+			}
+
+			muma_inner_tlsf_mark(b, MU_FALSE);
+			tlsf->usage += muma_inner_tlsf_size(b) + MUMA_TLSF_HEADER;
+			muma_inner_tlsf_trim(tlsf, b, size);
+			if (tlsf->usage > tlsf->peak_usage) {
+				tlsf->peak_usage = tlsf->usage;
+			}
+			return muma_inner_tlsf_data(b);
+		}
+
+		MUDEF void muma_tlsf_free(mumaTLSF* tlsf, void* p) {
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+
+			mumaTLSFBlock* b = muma_inner_tlsf_from_data(p);
+			tlsf->usage -= muma_inner_tlsf_size(b) + MUMA_TLSF_HEADER;
+
+			// Merge with the previous block
+			if (b->size & MUMA_TLSF_PREV_FREE) {
+				mumaTLSFBlock* prev = b->prev_phys;
+				muma_inner_tlsf_remove(tlsf, prev);
+				prev->size += MUMA_TLSF_HEADER + muma_inner_tlsf_size(b);
+				muma_inner_tlsf_next(prev)->prev_phys = prev;
+				b = prev;
+			}
+
+			// Merge with the next block
+			mumaTLSFBlock* next = muma_inner_tlsf_next(b);
+			if (next->size & MUMA_TLSF_BLOCK_FREE) {
+				muma_inner_tlsf_remove(tlsf, next);
+				b->size += MUMA_TLSF_HEADER + muma_inner_tlsf_size(next);
+				muma_inner_tlsf_next(b)->prev_phys = b;
+			}
+
+			muma_inner_tlsf_mark(b, MU_TRUE);
+			muma_inner_tlsf_insert(tlsf, b);
+		}
+
+		MUDEF void* muma_tlsf_realloc(mumaTLSF* tlsf, void* p, size_m size) {
+			if (p == MU_NULL_PTR) {
+				return muma_tlsf_malloc(tlsf, size);
+			}
+
+			size_m adjusted = muma_inner_tlsf_adjust(size);
+			if (adjusted == 0) {
+				return MU_NULL_PTR;
+			}
+
+			mumaTLSFBlock* b = muma_inner_tlsf_from_data(p);
+			size_m b_size = muma_inner_tlsf_size(b);
+
+			// Grow in place by taking over the next block
+			if (adjusted > b_size) {
+				mumaTLSFBlock* next = muma_inner_tlsf_next(b);
+				if ((next->size & MUMA_TLSF_BLOCK_FREE) == 0 || b_size + MUMA_TLSF_HEADER + muma_inner_tlsf_size(next) < adjusted) {
+					void* new_p = muma_tlsf_malloc(tlsf, size);
+					if (new_p == MU_NULL_PTR) {
+						return MU_NULL_PTR;
+					}
+					mu_memcpy(new_p, p, b_size);
+					muma_tlsf_free(tlsf, p);
+					return new_p;
+				}
+
+				muma_inner_tlsf_remove(tlsf, next);
+				tlsf->usage += MUMA_TLSF_HEADER + muma_inner_tlsf_size(next);
+				b->size += MUMA_TLSF_HEADER + muma_inner_tlsf_size(next);
+				muma_inner_tlsf_mark(b, MU_FALSE);
+				muma_inner_tlsf_next(b)->prev_phys = b;
+			}
+
+			muma_inner_tlsf_trim(tlsf, b, adjusted);
+			if (tlsf->usage > tlsf->peak_usage) {
+				tlsf->peak_usage = tlsf->usage;
+			}
+			return p;
+		}
+
+		MUDEF size_m muma_tlsf_block_size(void* p) {
+			return muma_inner_tlsf_size(muma_inner_tlsf_from_data(p));
+		}
+
+		static void* muma_inner_tlsf_allocate(void* user_data, size_m size) {
+			return muma_tlsf_malloc((mumaTLSF*)user_data, size);
+		}
+
+		static void* muma_inner_tlsf_reallocate(void* user_data, void* p, size_m old_size, size_m new_size) {
+			(void)old_size;
+			return muma_tlsf_realloc((mumaTLSF*)user_data, p, new_size);
+		}
+
+		static void muma_inner_tlsf_deallocate(void* user_data, void* p, size_m size) {
+			(void)size;
+			muma_tlsf_free((mumaTLSF*)user_data, p);
+		}
+
+		MUDEF mumaAllocator muma_tlsf_allocator(mumaTLSF* tlsf) {
+			mumaAllocator a = MU_ZERO_STRUCT(mumaAllocator);
+			a.allocate = muma_inner_tlsf_allocate;
+			a.reallocate = muma_inner_tlsf_reallocate;
+			a.deallocate = muma_inner_tlsf_deallocate;
+			a.user_data = tlsf;
+			return a;
+		}
+
+	/* Buddy allocator */
+
+		// Links of a free block, stored in the block's memory
+		struct mumaBuddyBlock {
+			mumaBuddyBlock* next;
+			mumaBuddyBlock* prev;
+		};
+
+		// Every byte of `orders` is 0 if no block starts at the
+		// corresponding minimum-sized block, and its order plus 1 if one
+		// does, with this bit set if that block is free
+		#define MUMA_BUDDY_FREE 0x80
+
+		#define muma_inner_buddy_block(b, offset) ((mumaBuddyBlock*)((b)->base + (offset)))
+		#define muma_inner_buddy_order_at(b, offset) ((size_m)((b)->orders[(offset) >> (b)->min_log2] & ~MUMA_BUDDY_FREE) - 1)
+
+		// Order of the smallest block that can hold `size` bytes, or
+		// MUMA_BUDDY_ORDER_COUNT if there isn't one
+		static size_m muma_inner_buddy_order(mumaBuddy* b, size_m size) {
+			if (size > b->size) {
+				return MUMA_BUDDY_ORDER_COUNT;
+			}
+			if (size <= b->min_block) {
+				return 0;
+			}
+			return muma_inner_fls(size-1) + 1 - b->min_log2;
+		}
+
+		static void muma_inner_buddy_push(mumaBuddy* b, size_m offset, size_m order) {
+			mumaBuddyBlock* block = muma_inner_buddy_block(b, offset);
+			block->next = b->free_lists[order];
+			block->prev = MU_NULL_PTR;
+			if (block->next != MU_NULL_PTR) {
+				block->next->prev = block;
+			}
+			b->free_lists[order] = block;
+			b->free_bitmap |= (uint64_m)1 << order;
+			b->orders[offset >> b->min_log2] = (muByte)((order+1) | MUMA_BUDDY_FREE);
+			b->free_blocks++;
+		}
+
+		static void muma_inner_buddy_remove(mumaBuddy* b, size_m offset, size_m order) {
+			mumaBuddyBlock* block = muma_inner_buddy_block(b, offset);
+			if (block->next != MU_NULL_PTR) {
+				block->next->prev = block->prev;
+			}
+			if (block->prev != MU_NULL_PTR) {
+				block->prev->next = block->next;
+			} else {
+				b->free_lists[order] = block->next;
+				if (block->next == MU_NULL_PTR) {
+					b->free_bitmap &= ~((uint64_m)1 << order);
+				}
+			}
+			b->orders[offset >> b->min_log2] = 0;
+			b->free_blocks--;
+		}
+
+		// Whether or not the block at `offset` is free and of the given order
+		static MUMA_INLINE muBool muma_inner_buddy_is_free(mumaBuddy* b, size_m offset, size_m order) {
+			if (offset >= b->size || b->size - offset < (b->min_block << order)) {
+				return MU_FALSE;
+			}
+			return b->orders[offset >> b->min_log2] == (muByte)((order+1) | MUMA_BUDDY_FREE);
+		}
+
+		MUDEF mumaBuddy* muma_buddy_create(void* memory, size_m size, size_m min_block) {
+			size_m min_log2 = 4;
+			while (((size_m)1 << min_log2) < min_block) {
+				min_log2++;
+			}
+			min_block = (size_m)1 << min_log2;
+
+			// Align the start of the region
+			size_m pad = (16 - ((size_m)memory & 15)) & 15;
+			size_m header = (sizeof(mumaBuddy) + 15) & ~(size_m)15;
+			if (memory == MU_NULL_PTR || size < pad + header + min_block*2) {
+				return MU_NULL_PTR;
+			}
+			muByte* end = ((muByte*)memory) + size;
+
+			// Each minimum-sized block needs a byte in the order table,
+			// which sits between the bookkeeping and the blocks
+			mumaBuddy* b = (mumaBuddy*)(((muByte*)memory) + pad);
+			muByte* orders = ((muByte*)b) + header;
+			size_m count = (size - pad - header) / (min_block + 1);
+			muByte* base;
+			for (;;) {
+				if (count == 0) {
+					return MU_NULL_PTR;
+				}
+				size_m table_end = (size_m)(orders + count);
+				base = (muByte*)((table_end + (min_block-1)) & ~(min_block-1));
+				if (base <= end && (size_m)(end - base) >= count*min_block) {
+					break;
+				}
+				count--;
+			}
+
+			mu_memset(b, 0, sizeof(mumaBuddy));
+			mu_memset(orders, 0, count);
+			b->size = count*min_block;
+			b->min_block = min_block;
+			b->min_log2 = min_log2;
+			b->base = base;
+			b->orders = orders;
+
+			// Split the region into the largest aligned blocks that fit
+			size_m offset = 0;
+			while (offset < b->size) {
+				size_m order = 0;
+				while (order+1 < MUMA_BUDDY_ORDER_COUNT && order+1 + min_log2 < sizeof(size_m)*8
+					&& (offset & ((min_block << (order+1)) - 1)) == 0
+					&& b->size - offset >= (min_block << (order+1))
+				) {
+					order++;
+				}
+				if (order > b->max_order) {
+					b->max_order = order;
+				}
+				muma_inner_buddy_push(b, offset, order);
+				offset += min_block << order;
+			}
+
+			return b;
+		}
+
+		MUDEF void* muma_buddy_malloc(mumaBuddy* b, size_m size) {
+			size_m order = muma_inner_buddy_order(b, size);
+			if (order > b->max_order) {
+				return MU_NULL_PTR;
+			}
+
+			// Smallest free block that is large enough
+			uint64_m candidates = b->free_bitmap & ((~(uint64_m)0) << order);
+			if (candidates == 0) {
+				return MU_NULL_PTR;
+			}
+			size_m found = MUMA_CTZ64(candidates);
+			size_m offset = (size_m)((muByte*)b->free_lists[found] - b->base);
+			muma_inner_buddy_remove(b, offset, found);
+
+			// Split it down to the needed order, freeing the upper halves
+			while (found > order) {
+				found--;
+				muma_inner_buddy_push(b, offset + (b->min_block << found), found);
+			}
+
+			b->orders[offset >> b->min_log2] = (muByte)(order+1);
+			b->allocated += b->min_block << order;
+			b->requested += size;
+			return b->base + offset;
+		}
+
+		MUDEF void muma_buddy_free(mumaBuddy* b, void* p, size_m size) {
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+
+			size_m offset = (size_m)((muByte*)p - b->base);
+			size_m order = muma_inner_buddy_order_at(b, offset);
+			b->allocated -= b->min_block << order;
+			b->requested -= size;
+
+			// Merge with the buddy for as long as it's free
+			while (order+1 < MUMA_BUDDY_ORDER_COUNT) {
+				size_m buddy = offset ^ (b->min_block << order);
+				if (!muma_inner_buddy_is_free(b, buddy, order)) {
+					break;
+				}
+				muma_inner_buddy_remove(b, buddy, order);
+				b->orders[offset >> b->min_log2] = 0;
+				if (buddy < offset) {
+					offset = buddy;
+				}
+				order++;
+			}
+
+			muma_inner_buddy_push(b, offset, order);
+		}
+
+		MUDEF void* muma_buddy_realloc(mumaBuddy* b, void* p, size_m old_size, size_m new_size) {
+			if (p == MU_NULL_PTR) {
+				return muma_buddy_malloc(b, new_size);
+			}
+
+			size_m offset = (size_m)((muByte*)p - b->base);
+			size_m order = muma_inner_buddy_order_at(b, offset);
+			size_m new_order = muma_inner_buddy_order(b, new_size);
+			if (new_order > b->max_order) {
+				return MU_NULL_PTR;
+			}
+
+			muBool in_place = MU_TRUE;
+			if (new_order > order) {
+				// Growing in place needs every buddy up to the new order to
+				// be free and after the block
+				for (size_m o = order; o < new_order; o++) {
+					if ((offset & (b->min_block << o)) != 0 || !muma_inner_buddy_is_free(b, offset + (b->min_block << o), o)) {
+						in_place = MU_FALSE;
+						break;
+					}
+				}
+				if (in_place) {
+					for (size_m o = order; o < new_order; o++) {
+						muma_inner_buddy_remove(b, offset + (b->min_block << o), o);
+					}
+				}
+			} else {
+				// Shrinking frees the upper halves, which can't be merged
+				// with anything, since their buddies are still allocated
+				for (size_m o = order; o > new_order; o--) {
+					muma_inner_buddy_push(b, offset + (b->min_block << (o-1)), o-1);
+				}
+			}
+
+			if (!in_place) {
+				void* new_p = muma_buddy_malloc(b, new_size);
+				if (new_p == MU_NULL_PTR) {
+					return MU_NULL_PTR;
+				}
+				mu_memcpy(new_p, p, (old_size < new_size) ? old_size : new_size);
+				muma_buddy_free(b, p, old_size);
+				b->moved_reallocs++;
+				return new_p;
+			}
+
+			b->orders[offset >> b->min_log2] = (muByte)(new_order+1);
+			b->allocated = b->allocated - (b->min_block << order) + (b->min_block << new_order);
+			b->requested = b->requested - old_size + new_size;
+			b->in_place_reallocs++;
+			return p;
+		}
+
+		MUDEF mumaBuddyStats muma_buddy_get_stats(mumaBuddy* b) {
+			mumaBuddyStats stats = MU_ZERO_STRUCT(mumaBuddyStats);
+			stats.size = b->size;
+			stats.requested = b->requested;
+			stats.allocated = b->allocated;
+			stats.free = b->size - b->allocated;
+			stats.free_blocks = b->free_blocks;
+			stats.largest_free_block = 0;
+			for (size_m o = b->max_order+1; o > 0; o--) {
+				if (b->free_bitmap & ((uint64_m)1 << (o-1))) {
+					stats.largest_free_block = b->min_block << (o-1);
+					break;
+				}
+			}
+			stats.in_place_reallocs = b->in_place_reallocs;
+			stats.moved_reallocs = b->moved_reallocs;
+			stats.internal_fragmentation = (stats.allocated == 0) ? 0.0 : 1.0 - (double)stats.requested / (double)stats.allocated;
+			stats.external_fragmentation = (stats.free == 0) ? 0.0 : 1.0 - (double)stats.largest_free_block / (double)stats.free;
+			return stats;
+		}
+
+		static void* muma_inner_buddy_allocate(void* user_data, size_m size) {
+			return muma_buddy_malloc((mumaBuddy*)user_data, size);
+		}
+
+		static void* muma_inner_buddy_reallocate(void* user_data, void* p, size_m old_size, size_m new_size) {
+			return muma_buddy_realloc((mumaBuddy*)user_data, p, old_size, new_size);
+		}
+
+		static void muma_inner_buddy_deallocate(void* user_data, void* p, size_m size) {
+			muma_buddy_free((mumaBuddy*)user_data, p, size);
+		}
+
+		MUDEF mumaAllocator muma_buddy_allocator(mumaBuddy* buddy) {
+			mumaAllocator a = MU_ZERO_STRUCT(mumaAllocator);
+			a.allocate = muma_inner_buddy_allocate;
+			a.reallocate = muma_inner_buddy_reallocate;
+			a.deallocate = muma_inner_buddy_deallocate;
+			a.user_data = buddy;
+			return a;
+		}
+
+	/* String builder */
+
+		// What `data` points to while nothing is allocated, so that it is
+		// always NUL-terminated
+		static char muma_inner_string_builder_empty[1] = { 0 };
+
+		MUDEF mumaStringBuilder muma_string_builder_create(mumaResult* result, size_m allocated_length) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			mumaStringBuilder builder = MU_ZERO_STRUCT(mumaStringBuilder);
+			builder.data = muma_inner_string_builder_empty;
+			builder.length = 0;
+			builder.allocated_length = 0;
+
+			if (allocated_length != 0) {
+				muma_string_builder_reserve(result, &builder, allocated_length);
+			}
+			return builder;
+		}
+
+		MUDEF void muma_string_builder_destroy(mumaStringBuilder* builder) {
+			if (builder->allocated_length != 0) {
+				muma_free(builder->data, builder->allocated_length);
+			}
+			builder->data = muma_inner_string_builder_empty;
+			builder->length = 0;
+			builder->allocated_length = 0;
+		}
+
+		MUDEF void muma_string_builder_reserve(mumaResult* result, mumaStringBuilder* builder, size_m length) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			if (length < builder->allocated_length) {
+				return;
+			}
+
+			size_m allocated_length = (builder->allocated_length < 64) ? 64 : builder->allocated_length*2;
+			while (allocated_length <= length) {
+				allocated_length *= 2;
+			}
+
+			mumaResult res = MUMA_SUCCESS;
+			char* data = (char*)muma_realloc(&res,
+				(builder->allocated_length == 0) ? MU_NULL_PTR : builder->data,
+				builder->allocated_length, allocated_length
+			);
+			if (data == MU_NULL_PTR) {
+				MU_SET_RESULT(result, res)
+				return;
+			}
+
+			if (builder->allocated_length == 0) {
+				data[0] = 0;
+			}
+			builder->data = data;
+			builder->allocated_length = allocated_length;
+		}
+
+		MUDEF void muma_string_builder_clear(mumaStringBuilder* builder) {
+			builder->length = 0;
+			builder->data[0] = 0;
+		}
+
+		// Makes room for `size` more characters (and the terminator),
+		// returning where they should be written, or 0 on failure.
+		static MUMA_INLINE char* muma_inner_string_builder_grow(mumaResult* result, mumaStringBuilder* builder, size_m size) {
+			if (builder->length + size >= builder->allocated_length) {
+				mumaResult res = MUMA_SUCCESS;
+				muma_string_builder_reserve(&res, builder, builder->length + size);
+				if (res != MUMA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return MU_NULL_PTR;
+				}
+			}
+			return &builder->data[builder->length];
+		}
+
+		MUDEF void muma_string_builder_append(mumaResult* result, mumaStringBuilder* builder, const void* data, size_m size) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			char* p = muma_inner_string_builder_grow(result, builder, size);
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+			if (size != 0) {
+				mu_memcpy(p, data, size);
+			}
+			builder->length += size;
+			builder->data[builder->length] = 0;
+		}
+
+		MUDEF void muma_string_builder_append_cstr(mumaResult* result, mumaStringBuilder* builder, const char* cstr) {
+			size_m size = 0;
+			while (cstr[size] != 0) {
+				size++;
+			}
+			muma_string_builder_append(result, builder, cstr, size);
+		}
+
+		MUDEF void muma_string_builder_append_char(mumaResult* result, mumaStringBuilder* builder, char c) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			char* p = muma_inner_string_builder_grow(result, builder, 1);
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+			p[0] = c;
+			p[1] = 0;
+			builder->length++;
+		}
+
+		static const char muma_inner_digit_pairs[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		// Amount of decimal digits in `v` (at least 1)
+		static MUMA_INLINE size_m muma_inner_decimal_digits(uint64_m v) {
+			size_m digits = 1;
+			for (;;) {
+				if (v < 10) return digits;
+				if (v < 100) return digits + 1;
+				if (v < 1000) return digits + 2;
+				if (v < 10000) return digits + 3;
+				v /= 10000;
+				digits += 4;
+			}
+		}
+
+		// Writes exactly `digits` digits of `v` ending right before `end`
+		// (padding with zeros), two at a time from the back.
+		static MUMA_INLINE void muma_inner_write_digits(char* end, uint64_m v, size_m digits) {
+			while (digits >= 2) {
+				size_m pair = (size_m)(v % 100) * 2;
+				v /= 100;
+				end -= 2;
+				end[0] = muma_inner_digit_pairs[pair];
+				end[1] = muma_inner_digit_pairs[pair+1];
+				digits -= 2;
+			}
+			if (digits == 1) {
+				end[-1] = (char)('0' + (v % 10));
+			}
+		}
+
+		static void muma_inner_string_builder_append_uint(mumaResult* result, mumaStringBuilder* builder, uint64_m value, muBool negative) {
+			size_m digits = muma_inner_decimal_digits(value);
+			size_m size = digits + (negative ? 1 : 0);
+
+			char* p = muma_inner_string_builder_grow(result, builder, size);
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+			if (negative) {
+				p[0] = '-';
+			}
+			muma_inner_write_digits(p + size, value, digits);
+			builder->length += size;
+			builder->data[builder->length] = 0;
+		}
+
+		MUDEF void muma_string_builder_append_uint(mumaResult* result, mumaStringBuilder* builder, uint64_m value) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+			muma_inner_string_builder_append_uint(result, builder, value, MU_FALSE);
+		}
+
+		MUDEF void muma_string_builder_append_int(mumaResult* result, mumaStringBuilder* builder, int64_m value) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			// Negated as unsigned, so that the smallest value doesn't overflow
+			if (value < 0) {
+				muma_inner_string_builder_append_uint(result, builder, (uint64_m)0 - (uint64_m)value, MU_TRUE);
+			} else {
+				muma_inner_string_builder_append_uint(result, builder, (uint64_m)value, MU_FALSE);
+			}
+		}
+
+		// Rounds `fraction` (in [0, 1)) to a multiple of 1/`power`, returning
+		// the multiple, which can be `power` itself if it rounds up to 1.
+		// The double is exactly m/2^s, so m*power (at most 83 bits, kept
+		// in two words) is divided by 2^s exactly, rounding ties to even
+		// (the last digit being `integer`'s if there are no decimals).
+		static uint64_m muma_inner_round_fraction(double fraction, uint64_m power, uint64_m integer) {
+			uint64_m bits;
+			mu_memcpy(&bits, &fraction, sizeof(bits));
+			uint64_m exponent = (bits >> 52) & 0x7FF;
+			uint64_m m = bits & 0xFFFFFFFFFFFFFULL;
+			if (m == 0 && exponent == 0) {
+				return 0;
+			}
+			uint64_m shift = (exponent == 0) ? 1074 : 1075 - exponent;
+			if (exponent != 0) {
+				m |= 1ULL << 52;
+			}
+			// m*power < 2^83 <= 2^(shift-1), so it rounds down to 0
+			if (shift >= 84) {
+				return 0;
+			}
+
+			uint64_m low_product = (m & 0xFFFFFFFFULL) * power;
+			uint64_m high_product = (m >> 32) * power;
+			uint64_m lo = low_product + (high_product << 32);
+			uint64_m hi = (high_product >> 32) + (lo < low_product ? 1 : 0);
+
+			// Quotient, remainder, and half of the divisor, in two words
+			uint64_m q, rem_hi, rem_lo, half_hi, half_lo;
+			if (shift < 64) {
+				q = (hi << (64-shift)) | (lo >> shift);
+				rem_hi = 0;
+				rem_lo = lo & ((1ULL << shift) - 1);
+				half_hi = 0;
+				half_lo = 1ULL << (shift-1);
+			} else {
+				q = hi >> (shift-64);
+				rem_hi = hi & ((1ULL << (shift-64)) - 1);
+				rem_lo = lo;
+				half_hi = (shift == 64) ? 0 : 1ULL << (shift-65);
+				half_lo = (shift == 64) ? 1ULL << 63 : 0;
+			}
+
+			if (rem_hi > half_hi || (rem_hi == half_hi && rem_lo > half_lo)) {
+				return q + 1;
+			}
+			if (rem_hi == half_hi && rem_lo == half_lo) {
+				return q + (((power == 1) ? integer : q) & 1);
+			}
+			return q;
+		}
+
+		MUDEF void muma_string_builder_append_double(mumaResult* result, mumaStringBuilder* builder, double value, size_m decimals) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			static const uint64_m powers[10] = {
+				1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL,
+				1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL
+			};
+			if (decimals > 9) {
+				decimals = 9;
+			}
+
+			if (value != value) {
+				muma_string_builder_append(result, builder, "nan", 3);
+				return;
+			}
+			muBool negative = value < 0.0 || (value == 0.0 && 1.0/value < 0.0);
+			double magnitude = negative ? -value : value;
+			if (magnitude > 1.7976931348623157e308) {
+				muma_string_builder_append(result, builder, negative ? "-inf" : "inf", negative ? 4 : 3);
+				return;
+			}
+
+			// Scientific notation for values whose integer part doesn't fit
+			// in a uint64_m; the exponent is found by repeated division,
+			// which is slow, but such values are rare in practice.
+			int exponent = 0;
+			if (magnitude >= 1e19) {
+				while (magnitude >= 1e10) {
+					magnitude /= 1e10;
+					exponent += 10;
+				}
+				while (magnitude >= 10.0) {
+					magnitude /= 10.0;
+					exponent++;
+				}
+			}
+
+			// The integer part is exact, and so is the subtraction, so only
+			// the fractional part needs rounding (which may carry over).
+			uint64_m integer = (uint64_m)magnitude;
+			uint64_m fraction = muma_inner_round_fraction(magnitude - (double)integer, powers[decimals], integer);
+			if (fraction == powers[decimals]) {
+				integer++;
+				fraction = 0;
+			}
+			if (exponent != 0 && integer >= 10) {
+				// Rounded up to exactly 10 (e.g. 9.999 -> 10.00)
+				integer = 1;
+				fraction = 0;
+				exponent++;
+			}
+
+			size_m integer_digits = muma_inner_decimal_digits(integer);
+			size_m exponent_digits = (exponent == 0) ? 0 : muma_inner_decimal_digits((uint64_m)exponent);
+			if (exponent_digits == 1) {
+				exponent_digits = 2;
+			}
+			size_m size = (negative ? 1 : 0) + integer_digits + (decimals != 0 ? 1 + decimals : 0) + (exponent != 0 ? 2 + exponent_digits : 0);
+
+			char* p = muma_inner_string_builder_grow(result, builder, size);
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+
+			char* w = p;
+			if (negative) {
+				*w++ = '-';
+			}
+			muma_inner_write_digits(w + integer_digits, integer, integer_digits);
+			w += integer_digits;
+			if (decimals != 0) {
+				*w++ = '.';
+				muma_inner_write_digits(w + decimals, fraction, decimals);
+				w += decimals;
+			}
+			if (exponent != 0) {
+				*w++ = 'e';
+				*w++ = '+';
+				muma_inner_write_digits(w + exponent_digits, (uint64_m)exponent, exponent_digits);
+			}
+
+			builder->length += size;
+			builder->data[builder->length] = 0;
+		}
+
+		MUDEF char* muma_string_builder_finish(mumaResult* result, mumaStringBuilder* builder, size_m* allocated_length) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			// Nothing is allocated yet, so the empty string is allocated
+			// exactly, rather than with reserve's minimum size.
+			if (builder->allocated_length == 0) {
+				mumaResult res = MUMA_SUCCESS;
+				char* empty = (char*)muma_malloc(&res, 1);
+				if (empty == MU_NULL_PTR) {
+					MU_SET_RESULT(result, res)
+					return MU_NULL_PTR;
+				}
+				empty[0] = 0;
+				if (allocated_length != MU_NULL_PTR) {
+					*allocated_length = 1;
+				}
+				return empty;
+			}
+
+			char* data = builder->data;
+			if (allocated_length != MU_NULL_PTR) {
+				*allocated_length = builder->allocated_length;
+			}
+			builder->data = muma_inner_string_builder_empty;
+			builder->length = 0;
+			builder->allocated_length = 0;
+			return data;
+		}
+
+	/* I/O */
+
+		#if defined(MU_UNIX)
+			#include <unistd.h>
+			#include <sys/uio.h>
+			#include <errno.h>
+		#elif defined(MU_WIN32)
+			#include <io.h>
+			#include <errno.h>
+		#endif
+
+		// Maximum amount of vectors passed to a single readv/writev
+		#define MUMA_IOV_COUNT 64
+
+		MUDEF size_m muma_read(mumaResult* result, int fd, void* data, size_m size) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			#if defined(MU_UNIX)
+				ssize_t r;
+				do {
+					r = read(fd, data, size);
+				} while (r < 0 && errno == EINTR);
+			#elif defined(MU_WIN32)
+				int r;
+				do {
+					r = _read(fd, data, (size > 0x7FFFFFFF) ? 0x7FFFFFFF : (unsigned int)size);
+				} while (r < 0 && errno == EINTR);
+			#else
+				int r = -1;
+				(void)fd; (void)data; (void)size;
+			#endif
+
+			if (r < 0) {
+				MU_SET_RESULT(result, MUMA_IO_FAILED)
+				return 0;
+			}
+			return (size_m)r;
+		}
+
+		MUDEF size_m muma_readv(mumaResult* result, int fd, mumaIOVec* vecs, size_m count) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			if (count > MUMA_IOV_COUNT) {
+				count = MUMA_IOV_COUNT;
+			}
+
+			#if defined(MU_UNIX)
+				struct iovec iov[MUMA_IOV_COUNT];
+				for (size_m i = 0; i < count; i++) {
+					iov[i].iov_base = vecs[i].data;
+					iov[i].iov_len = vecs[i].size;
+				}
+
+				ssize_t r;
+				do {
+					r = readv(fd, iov, (int)count);
+				} while (r < 0 && errno == EINTR);
+
+				if (r < 0) {
+					MU_SET_RESULT(result, MUMA_IO_FAILED)
+					return 0;
+				}
+				return (size_m)r;
+			#else
+				// No vectored read, so the ranges are read one by one,
+				// stopping at the first one that isn't filled.
+				size_m total = 0;
+				for (size_m i = 0; i < count; i++) {
+					mumaResult res = MUMA_SUCCESS;
+					size_m r = muma_read(&res, fd, vecs[i].data, vecs[i].size);
+					if (res != MUMA_SUCCESS) {
+						if (total == 0) {
+							MU_SET_RESULT(result, res)
+						}
+						break;
+					}
+					total += r;
+					if (r < vecs[i].size) {
+						break;
+					}
+				}
+				return total;
+			#endif
+		}
+
+		MUDEF size_m muma_write(mumaResult* result, int fd, const void* data, size_m size) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			size_m total = 0;
+			while (total < size) {
+				#if defined(MU_UNIX)
+					ssize_t r = write(fd, ((const muByte*)data)+total, size-total);
+				#elif defined(MU_WIN32)
+					size_m left = size-total;
+					int r = _write(fd, ((const muByte*)data)+total, (left > 0x7FFFFFFF) ? 0x7FFFFFFF : (unsigned int)left);
+				#else
+					int r = -1;
+					(void)fd; (void)data;
+				#endif
+
+				if (r < 0) {
+					#if defined(MU_UNIX) || defined(MU_WIN32)
+						if (errno == EINTR) {
+							continue;
+						}
+					#endif
+					MU_SET_RESULT(result, MUMA_IO_FAILED)
+					return total;
+				}
+				total += (size_m)r;
+			}
+			return total;
+		}
+
+		MUDEF size_m muma_writev(mumaResult* result, int fd, mumaIOVec* vecs, size_m count) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			size_m total = 0;
+
+			#if defined(MU_UNIX)
+				// Index of the current vector and how much of it has been written
+				size_m i = 0;
+				size_m offset = 0;
+				while (i < count) {
+					struct iovec iov[MUMA_IOV_COUNT];
+					int iov_count = 0;
+					for (size_m j = i; j < count && iov_count < MUMA_IOV_COUNT; j++) {
+						size_m skip = (j == i) ? offset : 0;
+						iov[iov_count].iov_base = ((muByte*)vecs[j].data) + skip;
+						iov[iov_count].iov_len = vecs[j].size - skip;
+						iov_count++;
+					}
+
+					ssize_t r = writev(fd, iov, iov_count);
+					if (r < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						MU_SET_RESULT(result, MUMA_IO_FAILED)
+						return total;
+					}
+					total += (size_m)r;
+
+					size_m written = (size_m)r;
+					while (i < count && written >= vecs[i].size-offset) {
+						written -= vecs[i].size-offset;
+						offset = 0;
+						i++;
+					}
+					offset += written;
+				}
+			#else
+				for (size_m i = 0; i < count; i++) {
+					mumaResult res = MUMA_SUCCESS;
+					total += muma_write(&res, fd, vecs[i].data, vecs[i].size);
+					if (res != MUMA_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						return total;
+					}
+				}
+			#endif
+
+			return total;
+		}
+
+	/* Threads */
+
+		#if !defined(MUMA_NO_THREADS) && defined(MU_UNIX)
+			#include <pthread.h>
+			#define MUMA_INNER_PTHREADS
+		#elif !defined(MUMA_NO_THREADS) && defined(MU_WIN32)
+			#include <windows.h>
+			#define MUMA_INNER_WIN32_THREADS
+		#endif
+
+		#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+
+			struct mumaInnerTask {
+				mumaTaskFunc func;
+				void* user_data;
+				size_m index;
+				muBool started;
+				#ifdef MUMA_INNER_PTHREADS
+					pthread_t thread;
+				#else
+					HANDLE thread;
+				#endif
+			}; typedef struct mumaInnerTask mumaInnerTask;
+
+			#ifdef MUMA_INNER_PTHREADS
+				static void* muma_inner_task_main(void* p) {
+					mumaInnerTask* task = (mumaInnerTask*)p;
+					task->func(task->user_data, task->index);
+					return MU_NULL_PTR;
+				}
+			#else
+				static DWORD WINAPI muma_inner_task_main(LPVOID p) {
+					mumaInnerTask* task = (mumaInnerTask*)p;
+					task->func(task->user_data, task->index);
+					return 0;
+				}
+			#endif
+
+		#endif
+
+		MUDEF void muma_parallel_run(size_m count, mumaTaskFunc func, void* user_data) {
+			#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+				if (count > 1) {
+					mumaInnerTask* tasks = (mumaInnerTask*)muma_malloc(MU_NULL_PTR, sizeof(mumaInnerTask)*(count-1));
+					if (tasks != MU_NULL_PTR) {
+						for (size_m i = 1; i < count; i++) {
+							mumaInnerTask* task = &tasks[i-1];
+							task->func = func;
+							task->user_data = user_data;
+							task->index = i;
+							#ifdef MUMA_INNER_PTHREADS
+								task->started = pthread_create(&task->thread, MU_NULL_PTR, muma_inner_task_main, task) == 0;
+							#else
+								task->thread = CreateThread(MU_NULL_PTR, 0, muma_inner_task_main, task, 0, MU_NULL_PTR);
+								task->started = task->thread != MU_NULL_PTR;
+							#endif
+							if (!task->started) {
+								func(user_data, i);
+							}
+						}
+
+						func(user_data, 0);
+
+						for (size_m i = 1; i < count; i++) {
+							if (tasks[i-1].started) {
+								#ifdef MUMA_INNER_PTHREADS
+									pthread_join(tasks[i-1].thread, MU_NULL_PTR);
+								#else
+									WaitForSingleObject(tasks[i-1].thread, INFINITE);
+									CloseHandle(tasks[i-1].thread);
+								#endif
+							}
+						}
+
+						muma_free(tasks, sizeof(mumaInnerTask)*(count-1));
+						return;
+					}
+				}
+			#endif
+
+			for (size_m i = 0; i < count; i++) {
+				func(user_data, i);
+			}
+		}
+
+		MUDEF size_m muma_thread_count(void) {
+			#if defined(MU_UNIX)
+				long count = sysconf(_SC_NPROCESSORS_ONLN);
+				return (count > 0) ? (size_m)count : 1;
+			#elif defined(MUMA_INNER_WIN32_THREADS)
+				SYSTEM_INFO info;
+				GetSystemInfo(&info);
+				return (info.dwNumberOfProcessors > 0) ? (size_m)info.dwNumberOfProcessors : 1;
+			#else
+				return 1;
+			#endif
+		}
+
+	/* Caching allocator */
+
+		// Mutexes, which do nothing if threads are turned off
+		#if defined(MUMA_INNER_PTHREADS)
+			typedef pthread_mutex_t mumaInnerMutex;
+			#define muma_inner_mutex_init(m) pthread_mutex_init((m), MU_NULL_PTR)
+			#define muma_inner_mutex_destroy(m) pthread_mutex_destroy(m)
+			#define muma_inner_mutex_lock(m) pthread_mutex_lock(m)
+			#define muma_inner_mutex_unlock(m) pthread_mutex_unlock(m)
+		#elif defined(MUMA_INNER_WIN32_THREADS)
+			typedef CRITICAL_SECTION mumaInnerMutex;
+			#define muma_inner_mutex_init(m) InitializeCriticalSection(m)
+			#define muma_inner_mutex_destroy(m) DeleteCriticalSection(m)
+			#define muma_inner_mutex_lock(m) EnterCriticalSection(m)
+			#define muma_inner_mutex_unlock(m) LeaveCriticalSection(m)
+		#else
+			typedef int mumaInnerMutex;
+			#define muma_inner_mutex_init(m) ((void)(m))
+			#define muma_inner_mutex_destroy(m) ((void)(m))
+			#define muma_inner_mutex_lock(m) ((void)(m))
+			#define muma_inner_mutex_unlock(m) ((void)(m))
+		#endif
+
+		// Free block, linked through its own memory
+		struct mumaInnerCachingBlock {
+			struct mumaInnerCachingBlock* next;
+		}; typedef struct mumaInnerCachingBlock mumaInnerCachingBlock;
+
+		// Header at the start of every chunk of blocks
+		struct mumaInnerCachingChunk {
+			struct mumaInnerCachingChunk* next;
+		}; typedef struct mumaInnerCachingChunk mumaInnerCachingChunk;
+
+		#define MUMA_CACHING_CHUNK_HEADER ((sizeof(mumaInnerCachingChunk) + 15) & ~(size_m)15)
+		// Bytes of blocks in a chunk (at least two blocks)
+		#define MUMA_CACHING_CHUNK_SIZE ((size_m)1 << 17)
+
+		// Central pool of a size class; padded so that the locks of
+		// different classes don't share a cache line
+		struct mumaInnerCachingClass {
+			mumaInnerMutex lock;
+			mumaInnerCachingBlock* head;
+			mumaInnerCachingChunk* chunks;
+			muByte padding[64];
+		}; typedef struct mumaInnerCachingClass mumaInnerCachingClass;
+
+		// A thread's cache for a caching allocator
+		struct mumaInnerThreadCache {
+			struct mumaInnerThreadCache* next;
+			mumaInnerCachingBlock* heads[MUMA_CACHING_CLASS_COUNT];
+			size_m counts[MUMA_CACHING_CLASS_COUNT];
+		}; typedef struct mumaInnerThreadCache mumaInnerThreadCache;
+
+		struct mumaCachingAllocator {
+			// Never reused, so that a thread's cache slots can't match a
+			// destroyed allocator
+			size_m id;
+			mumaInnerCachingClass classes[MUMA_CACHING_CLASS_COUNT];
+			// Every thread cache, so that they can be freed on destruction
+			mumaInnerMutex caches_lock;
+			mumaInnerThreadCache* caches;
+		};
+
+		static size_m muma_inner_caching_next_id = 0;
+
+		struct mumaInnerCacheSlot {
+			size_m id;
+			mumaInnerThreadCache* cache;
+		}; typedef struct mumaInnerCacheSlot mumaInnerCacheSlot;
+
+		static MUMA_THREAD_LOCAL mumaInnerCacheSlot muma_inner_cache_slots[MUMA_CACHING_THREAD_SLOTS];
+		static MUMA_THREAD_LOCAL size_m muma_inner_cache_evict;
+
+		// Size class of a size (which must not be above MUMA_CACHING_MAX_SIZE)
+		static MUMA_INLINE size_m muma_inner_caching_class(size_m size) {
+			if (size <= ((size_m)1 << MUMA_CACHING_MIN_LOG2)) {
+				return 0;
+			}
+			return muma_inner_fls(size-1) + 1 - MUMA_CACHING_MIN_LOG2;
+		}
+
+		// Amount of blocks moved between a thread cache and the central
+		// pool at once; a thread cache holds at most twice this amount
+		static MUMA_INLINE size_m muma_inner_caching_batch(size_m c) {
+			size_m batch = ((size_m)1 << 15) >> (c + MUMA_CACHING_MIN_LOG2);
+			return (batch > 64) ? 64 : (batch < 1) ? 1 : batch;
+		}
+
+		// The calling thread's cache for an allocator, created if needed
+		static mumaInnerThreadCache* muma_inner_caching_get_cache(mumaCachingAllocator* ca) {
+			mumaInnerCacheSlot* slot = MU_NULL_PTR;
+			for (size_m i = 0; i < MUMA_CACHING_THREAD_SLOTS; i++) {
+				if (muma_inner_cache_slots[i].id == ca->id) {
+					return muma_inner_cache_slots[i].cache;
+				}
+				if (slot == MU_NULL_PTR && muma_inner_cache_slots[i].id == 0) {
+					slot = &muma_inner_cache_slots[i];
+				}
+			}
+			// Abandon the oldest cache if every slot is taken
+			if (slot == MU_NULL_PTR) {
+				slot = &muma_inner_cache_slots[muma_inner_cache_evict];
+				muma_inner_cache_evict = (muma_inner_cache_evict + 1) % MUMA_CACHING_THREAD_SLOTS;
+			}
+
+			mumaInnerThreadCache* cache = (mumaInnerThreadCache*)mu_malloc(sizeof(mumaInnerThreadCache));
+			if (cache == MU_NULL_PTR) {
+				return MU_NULL_PTR;
+			}
+			mu_memset(cache, 0, sizeof(mumaInnerThreadCache));
+
+			muma_inner_mutex_lock(&ca->caches_lock);
+			cache->next = ca->caches;
+			ca->caches = cache;
+			muma_inner_mutex_unlock(&ca->caches_lock);
+
+			slot->id = ca->id;
+			slot->cache = cache;
+			return cache;
+		}
+
+		// Takes up to `count` blocks from the central pool of a class as a
+		// linked list, allocating a new chunk if it's empty
+		static mumaInnerCachingBlock* muma_inner_caching_take(mumaCachingAllocator* ca, size_m c, size_m count, size_m* p_taken) {
+			mumaInnerCachingClass* cl = &ca->classes[c];
+			size_m size = (size_m)1 << (c + MUMA_CACHING_MIN_LOG2);
+
+			muma_inner_mutex_lock(&cl->lock);
+			if (cl->head == MU_NULL_PTR) {
+				size_m blocks = MUMA_CACHING_CHUNK_SIZE / size;
+				mumaInnerCachingChunk* chunk = (mumaInnerCachingChunk*)mu_malloc(MUMA_CACHING_CHUNK_HEADER + blocks*size);
+				if (chunk == MU_NULL_PTR) {
+					muma_inner_mutex_unlock(&cl->lock);
+					*p_taken = 0;
+					return MU_NULL_PTR;
+				}
+				chunk->next = cl->chunks;
+				cl->chunks = chunk;
+
+				muByte* data = ((muByte*)chunk) + MUMA_CACHING_CHUNK_HEADER;
+				for (size_m i = blocks; i > 0; i--) {
+					mumaInnerCachingBlock* block = (mumaInnerCachingBlock*)(data + (i-1)*size);
+					block->next = cl->head;
+					cl->head = block;
+				}
+			}
+
+			mumaInnerCachingBlock* first = cl->head;
+			mumaInnerCachingBlock* last = first;
+			size_m taken = 1;
+			while (taken < count && last->next != MU_NULL_PTR) {
+				last = last->next;
+				taken++;
+			}
+			cl->head = last->next;
+			muma_inner_mutex_unlock(&cl->lock);
+
+			last->next = MU_NULL_PTR;
+			*p_taken = taken;
+			return first;
+		}
+
+		// Gives a linked list of blocks back to the central pool of a class
+		static void muma_inner_caching_give(mumaCachingAllocator* ca, size_m c, mumaInnerCachingBlock* first, mumaInnerCachingBlock* last) {
+			mumaInnerCachingClass* cl = &ca->classes[c];
+			muma_inner_mutex_lock(&cl->lock);
+			last->next = cl->head;
+			cl->head = first;
+			muma_inner_mutex_unlock(&cl->lock);
+		}
+
+		MUDEF mumaCachingAllocator* muma_caching_create(mumaResult* result) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			mumaCachingAllocator* ca = (mumaCachingAllocator*)mu_malloc(sizeof(mumaCachingAllocator));
+			if (ca == MU_NULL_PTR) {
+				MU_SET_RESULT(result, MUMA_FAILED_TO_ALLOCATE)
+				return MU_NULL_PTR;
+			}
+			mu_memset(ca, 0, sizeof(mumaCachingAllocator));
+
+			ca->id = MUMA_ATOMIC_ADD_FETCH(&muma_inner_caching_next_id, 1);
+			for (size_m c = 0; c < MUMA_CACHING_CLASS_COUNT; c++) {
+				muma_inner_mutex_init(&ca->classes[c].lock);
+			}
+			muma_inner_mutex_init(&ca->caches_lock);
+			return ca;
+		}
+
+		MUDEF void muma_caching_destroy(mumaCachingAllocator* ca) {
+			if (ca == MU_NULL_PTR) {
+				return;
+			}
+
+			// Forget the calling thread's cache; other threads' slots can't
+			// match this allocator again, since its ID is never reused
+			for (size_m i = 0; i < MUMA_CACHING_THREAD_SLOTS; i++) {
+				if (muma_inner_cache_slots[i].id == ca->id) {
+					muma_inner_cache_slots[i].id = 0;
+					muma_inner_cache_slots[i].cache = MU_NULL_PTR;
+				}
+			}
+
+			for (size_m c = 0; c < MUMA_CACHING_CLASS_COUNT; c++) {
+				mumaInnerCachingChunk* chunk = ca->classes[c].chunks;
+				while (chunk != MU_NULL_PTR) {
+					mumaInnerCachingChunk* next = chunk->next;
+					mu_free(chunk);
+					chunk = next;
+				}
+				muma_inner_mutex_destroy(&ca->classes[c].lock);
+			}
+
+			mumaInnerThreadCache* cache = ca->caches;
+			while (cache != MU_NULL_PTR) {
+				mumaInnerThreadCache* next = cache->next;
+				mu_free(cache);
+				cache = next;
+			}
+			muma_inner_mutex_destroy(&ca->caches_lock);
+			mu_free(ca);
+		}
+
+		MUDEF void* muma_caching_malloc(mumaCachingAllocator* ca, size_m size) {
+			if (size > MUMA_CACHING_MAX_SIZE) {
+				return mu_malloc(size);
+			}
+
+			size_m c = muma_inner_caching_class(size);
+			mumaInnerThreadCache* cache = muma_inner_caching_get_cache(ca);
+			size_m taken;
+
+			if (cache == MU_NULL_PTR) {
+				return muma_inner_caching_take(ca, c, 1, &taken);
+			}
+
+			mumaInnerCachingBlock* block = cache->heads[c];
+			if (block == MU_NULL_PTR) {
+				block = muma_inner_caching_take(ca, c, muma_inner_caching_batch(c), &taken);
+				if (block == MU_NULL_PTR) {
+					return MU_NULL_PTR;
+				}
+				cache->counts[c] = taken;
+			}
+
+			cache->heads[c] = block->next;
+			cache->counts[c]--;
+			return block;
+		}
+
+		MUDEF void muma_caching_free(mumaCachingAllocator* ca, void* p, size_m size) {
+			if (p == MU_NULL_PTR) {
+				return;
+			}
+			if (size > MUMA_CACHING_MAX_SIZE) {
+				mu_free(p);
+				return;
+			}
+
+			size_m c = muma_inner_caching_class(size);
+			mumaInnerCachingBlock* block = (mumaInnerCachingBlock*)p;
+			mumaInnerThreadCache* cache = muma_inner_caching_get_cache(ca);
+
+			if (cache == MU_NULL_PTR) {
+				muma_inner_caching_give(ca, c, block, block);
+				return;
+			}
+
+			block->next = cache->heads[c];
+			cache->heads[c] = block;
+			cache->counts[c]++;
+
+			// Give a batch back once the cache holds too many blocks
+			size_m batch = muma_inner_caching_batch(c);
+			if (cache->counts[c] > batch*2) {
+				mumaInnerCachingBlock* last = block;
+				for (size_m i = 1; i < batch; i++) {
+					last = last->next;
+				}
+				cache->heads[c] = last->next;
+				cache->counts[c] -= batch;
+				muma_inner_caching_give(ca, c, block, last);
+			}
+		}
+
+		MUDEF void* muma_caching_realloc(mumaCachingAllocator* ca, void* p, size_m old_size, size_m new_size) {
+			if (p == MU_NULL_PTR) {
+				return muma_caching_malloc(ca, new_size);
+			}
+
+			if (old_size > MUMA_CACHING_MAX_SIZE && new_size > MUMA_CACHING_MAX_SIZE) {
+				return mu_realloc(p, new_size);
+			}
+			if (old_size <= MUMA_CACHING_MAX_SIZE && new_size <= MUMA_CACHING_MAX_SIZE
+				&& muma_inner_caching_class(old_size) == muma_inner_caching_class(new_size)
+			) {
+				return p;
+			}
+
+			void* new_p = muma_caching_malloc(ca, new_size);
+			if (new_p == MU_NULL_PTR) {
+				return MU_NULL_PTR;
+			}
+			mu_memcpy(new_p, p, (old_size < new_size) ? old_size : new_size);
+			muma_caching_free(ca, p, old_size);
+			return new_p;
+		}
+
+		MUDEF void muma_caching_flush(mumaCachingAllocator* ca) {
+			for (size_m i = 0; i < MUMA_CACHING_THREAD_SLOTS; i++) {
+				if (muma_inner_cache_slots[i].id != ca->id) {
+					continue;
+				}
+
+				mumaInnerThreadCache* cache = muma_inner_cache_slots[i].cache;
+				for (size_m c = 0; c < MUMA_CACHING_CLASS_COUNT; c++) {
+					mumaInnerCachingBlock* first = cache->heads[c];
+					if (first == MU_NULL_PTR) {
+						continue;
+					}
+					mumaInnerCachingBlock* last = first;
+					while (last->next != MU_NULL_PTR) {
+						last = last->next;
+					}
+					muma_inner_caching_give(ca, c, first, last);
+					cache->heads[c] = MU_NULL_PTR;
+					cache->counts[c] = 0;
+				}
+				return;
+			}
+		}
+
+		static void* muma_inner_caching_allocate(void* user_data, size_m size) {
+			return muma_caching_malloc((mumaCachingAllocator*)user_data, size);
+		}
+
+		static void* muma_inner_caching_reallocate(void* user_data, void* p, size_m old_size, size_m new_size) {
+			return muma_caching_realloc((mumaCachingAllocator*)user_data, p, old_size, new_size);
+		}
+
+		static void muma_inner_caching_deallocate(void* user_data, void* p, size_m size) {
+			muma_caching_free((mumaCachingAllocator*)user_data, p, size);
+		}
+
+		MUDEF mumaAllocator muma_caching_allocator(mumaCachingAllocator* caching) {
+			mumaAllocator a = MU_ZERO_STRUCT(mumaAllocator);
+			a.allocate = muma_inner_caching_allocate;
+			a.reallocate = muma_inner_caching_reallocate;
+			a.deallocate = muma_inner_caching_deallocate;
+			a.user_data = caching;
+			return a;
+		}
+
+	/* Deferred freeing */
+
+		// Condition variable and yield wrappers, alongside the mutex
+		// wrappers above.
+		#if defined(MUMA_INNER_PTHREADS)
+			#include <sched.h>
+			typedef pthread_cond_t mumaInnerCond;
+			#define muma_inner_cond_init(c) pthread_cond_init((c), MU_NULL_PTR)
+			#define muma_inner_cond_destroy(c) pthread_cond_destroy(c)
+			#define muma_inner_cond_wait(c, m) pthread_cond_wait((c), (m))
+			#define muma_inner_cond_signal(c) pthread_cond_signal(c)
+			#define muma_inner_yield() sched_yield()
+		#elif defined(MUMA_INNER_WIN32_THREADS)
+			typedef CONDITION_VARIABLE mumaInnerCond;
+			#define muma_inner_cond_init(c) InitializeConditionVariable(c)
+			#define muma_inner_cond_destroy(c) ((void)(c))
+			#define muma_inner_cond_wait(c, m) SleepConditionVariableCS((c), (m), INFINITE)
+			#define muma_inner_cond_signal(c) WakeConditionVariable(c)
+			#define muma_inner_yield() SwitchToThread()
+		#else
+			#define muma_inner_yield() ((void)0)
+		#endif
+
+		// Written into the start of a deferred allocation, so deferring a
+		// free never allocates; this is why the threshold is at least
+		// the size of this struct.
+		struct mumaInnerDeferredNode {
+			struct mumaInnerDeferredNode* next;
+			size_m size;
+			// The budget that the allocation is counted against
+			mumaBudget* budget;
+		}; typedef struct mumaInnerDeferredNode mumaInnerDeferredNode;
+
+		// The queue is a lock-free stack: frees are pushed with a CAS,
+		// and the whole stack is taken at once with an exchange, which
+		// avoids ABA since nodes are never popped one at a time.
+		static void* muma_inner_deferred_head = MU_NULL_PTR;
+		static mumaDeferredFreeStats muma_inner_deferred_stats;
+
+		static muBool muma_inner_deferred_running = MU_FALSE;
+
+		#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+			// Set while the background thread is (about to be) waiting on
+			// the condition variable, so pushes only lock to wake it up.
+			static size_m muma_inner_deferred_sleeping = 0;
+			static size_m muma_inner_deferred_stopping = 0;
+			static mumaInnerMutex muma_inner_deferred_lock;
+			static mumaInnerCond muma_inner_deferred_cond;
+			#ifdef MUMA_INNER_PTHREADS
+				static pthread_t muma_inner_deferred_thread;
+			#else
+				static HANDLE muma_inner_deferred_thread;
+			#endif
+		#endif
+
+		// Only muma_deferred_free_start/stop write these, which aren't
+		// called concurrently, so an atomic add works as a store.
+		static void muma_inner_deferred_store(size_m* p, size_m v) {
+			MUMA_ATOMIC_ADD_FETCH(p, v - MUMA_ATOMIC_LOAD(p));
+		}
+
+		static muBool muma_inner_deferred_push(void* p, size_m size, mumaBudget* budget) {
+			#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+				mumaInnerDeferredNode* node = (mumaInnerDeferredNode*)p;
+				node->size = size;
+				node->budget = budget;
+
+				MUMA_ATOMIC_ADD_FETCH(&muma_inner_deferred_stats.pending_count, 1);
+				MUMA_ATOMIC_ADD_FETCH(&muma_inner_deferred_stats.pending_bytes, size);
+				MUMA_ATOMIC_ADD_FETCH(&muma_inner_deferred_stats.deferred_count, 1);
+				MUMA_ATOMIC_ADD_FETCH(&muma_inner_deferred_stats.deferred_bytes, size);
+
+				void* head;
+				do {
+					head = (void*)MUMA_ATOMIC_LOAD(&muma_inner_deferred_head);
+					node->next = (mumaInnerDeferredNode*)head;
+				} while (!MUMA_ATOMIC_CAS_PTR(&muma_inner_deferred_head, head, (void*)node));
+
+				// The background thread sets "sleeping" before checking the
+				// queue, and both are sequentially consistent, so either it
+				// sees this node or this sees it sleeping.
+				if (MUMA_ATOMIC_LOAD(&muma_inner_deferred_sleeping) != 0) {
+					muma_inner_mutex_lock(&muma_inner_deferred_lock);
+					muma_inner_cond_signal(&muma_inner_deferred_cond);
+					muma_inner_mutex_unlock(&muma_inner_deferred_lock);
+				}
+				return MU_TRUE;
+			#else
+				(void)p; (void)size; (void)budget;
+				return MU_FALSE;
+			#endif
+		}
+
+		// Frees everything currently queued; returns if anything was.
+		static muBool muma_inner_deferred_drain(void) {
+			mumaInnerDeferredNode* node = (mumaInnerDeferredNode*)MUMA_ATOMIC_EXCHANGE_PTR(&muma_inner_deferred_head, MU_NULL_PTR);
+			if (node == MU_NULL_PTR) {
+				return MU_FALSE;
+			}
+
+			while (node != MU_NULL_PTR) {
+				mumaInnerDeferredNode* next = node->next;
+				size_m size = node->size;
+				mumaBudget* budget = node->budget;
+				mu_free(node);
+				muma_budget_release(budget, size);
+				MUMA_ATOMIC_SUB_FETCH(&muma_inner_deferred_stats.pending_bytes, size);
+				MUMA_ATOMIC_SUB_FETCH(&muma_inner_deferred_stats.pending_count, 1);
+				node = next;
+			}
+			return MU_TRUE;
+		}
+
+		#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+
+			static void muma_inner_deferred_main(void) {
+				for (;;) {
+					if (muma_inner_deferred_drain()) {
+						continue;
+					}
+
+					muma_inner_mutex_lock(&muma_inner_deferred_lock);
+					MUMA_ATOMIC_ADD_FETCH(&muma_inner_deferred_sleeping, 1);
+					muBool stopping = MUMA_ATOMIC_LOAD(&muma_inner_deferred_stopping) != 0;
+					if (!stopping && (void*)MUMA_ATOMIC_LOAD(&muma_inner_deferred_head) == MU_NULL_PTR) {
+						muma_inner_cond_wait(&muma_inner_deferred_cond, &muma_inner_deferred_lock);
+					}
+					MUMA_ATOMIC_SUB_FETCH(&muma_inner_deferred_sleeping, 1);
+					muma_inner_mutex_unlock(&muma_inner_deferred_lock);
+
+					if (stopping) {
+						muma_inner_deferred_drain();
+						return;
+					}
+				}
+			}
+
+			#ifdef MUMA_INNER_PTHREADS
+				static void* muma_inner_deferred_thread_main(void* p) {
+					(void)p;
+					muma_inner_deferred_main();
+					return MU_NULL_PTR;
+				}
+			#else
+				static DWORD WINAPI muma_inner_deferred_thread_main(LPVOID p) {
+					(void)p;
+					muma_inner_deferred_main();
+					return 0;
+				}
+			#endif
+
+		#endif
+
+		MUDEF void muma_deferred_free_start(mumaResult* result, size_m threshold) {
+			MU_SET_RESULT(result, MUMA_SUCCESS)
+
+			if (threshold < sizeof(mumaInnerDeferredNode)) {
+				threshold = sizeof(mumaInnerDeferredNode);
+			}
+
+			#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+				if (!muma_inner_deferred_running) {
+					muma_inner_deferred_store(&muma_inner_deferred_stopping, 0);
+					muma_inner_mutex_init(&muma_inner_deferred_lock);
+					muma_inner_cond_init(&muma_inner_deferred_cond);
+
+					#ifdef MUMA_INNER_PTHREADS
+						muBool started = pthread_create(&muma_inner_deferred_thread, MU_NULL_PTR, muma_inner_deferred_thread_main, MU_NULL_PTR) == 0;
+					#else
+						muma_inner_deferred_thread = CreateThread(MU_NULL_PTR, 0, muma_inner_deferred_thread_main, MU_NULL_PTR, 0, MU_NULL_PTR);
+						muBool started = muma_inner_deferred_thread != MU_NULL_PTR;
+					#endif
+					if (!started) {
+						muma_inner_cond_destroy(&muma_inner_deferred_cond);
+						muma_inner_mutex_destroy(&muma_inner_deferred_lock);
+						MU_SET_RESULT(result, MUMA_THREAD_FAILED)
+						return;
+					}
+					muma_inner_deferred_running = MU_TRUE;
+				}
+
+				muma_inner_deferred_store(&muma_inner_deferred_threshold, threshold);
+			#else
+				MU_SET_RESULT(result, MUMA_THREAD_FAILED)
+			#endif
+		}
+
+		MUDEF void muma_deferred_free_flush(void) {
+			// Help with whatever is queued, then wait for whatever the
+			// background thread has already taken off the queue.
+			while (muma_inner_deferred_drain()) {}
+			while (MUMA_ATOMIC_LOAD(&muma_inner_deferred_stats.pending_count) != 0) {
+				muma_inner_yield();
+			}
+		}
+
+		MUDEF void muma_deferred_free_stop(void) {
+			if (!muma_inner_deferred_running) {
+				return;
+			}
+
+			muma_inner_deferred_store(&muma_inner_deferred_threshold, 0);
+
+			#if defined(MUMA_INNER_PTHREADS) || defined(MUMA_INNER_WIN32_THREADS)
+				muma_inner_mutex_lock(&muma_inner_deferred_lock);
+				muma_inner_deferred_store(&muma_inner_deferred_stopping, 1);
+				muma_inner_cond_signal(&muma_inner_deferred_cond);
+				muma_inner_mutex_unlock(&muma_inner_deferred_lock);
+
+				#ifdef MUMA_INNER_PTHREADS
+					pthread_join(muma_inner_deferred_thread, MU_NULL_PTR);
+				#else
+					WaitForSingleObject(muma_inner_deferred_thread, INFINITE);
+					CloseHandle(muma_inner_deferred_thread);
+				#endif
+
+				muma_inner_cond_destroy(&muma_inner_deferred_cond);
+				muma_inner_mutex_destroy(&muma_inner_deferred_lock);
+			#endif
+
+			muma_inner_deferred_running = MU_FALSE;
+			muma_deferred_free_flush();
+		}
+
+		MUDEF mumaDeferredFreeStats muma_deferred_free_get_stats(void) {
+			mumaDeferredFreeStats stats;
+			stats.pending_count = MUMA_ATOMIC_LOAD(&muma_inner_deferred_stats.pending_count);
+			stats.pending_bytes = MUMA_ATOMIC_LOAD(&muma_inner_deferred_stats.pending_bytes);
+			stats.deferred_count = MUMA_ATOMIC_LOAD(&muma_inner_deferred_stats.deferred_count);
+			stats.deferred_bytes = MUMA_ATOMIC_LOAD(&muma_inner_deferred_stats.deferred_bytes);
+			return stats;
+		}
+
+	/* Epochs */
+
+		// The current epoch; entering readers are counted per parity.
+		static size_m muma_inner_epoch = 0;
+		static size_m muma_inner_epoch_readers[2] = { 0, 0 };
+
+		// Memory retired in an epoch of each parity, and a spin lock
+		// around the lists and advancing the epoch. Retiring and
+		// reclaiming only happen when arrays grow, so a spin lock is
+		// cheap enough here.
+		static mumaEpochNode* muma_inner_epoch_retired[2] = { MU_NULL_PTR, MU_NULL_PTR };
+		static void* muma_inner_epoch_lock = MU_NULL_PTR;
+
+		static void muma_inner_epoch_lock_acquire(void) {
+			while (!MUMA_ATOMIC_CAS_PTR(&muma_inner_epoch_lock, MU_NULL_PTR, (void*)&muma_inner_epoch_lock)) {
+				muma_inner_yield();
+			}
+		}
+
+		static void muma_inner_epoch_lock_release(void) {
+			(void)MUMA_ATOMIC_EXCHANGE_PTR(&muma_inner_epoch_lock, MU_NULL_PTR);
+		}
+
+		MUDEF size_m muma_epoch_enter(void) {
+			// If the epoch advances between loading it and being counted,
+			// the count may be too late to hold back reclamation, so it is
+			// undone and retried.
+			for (;;) {
+				size_m epoch = MUMA_ATOMIC_LOAD(&muma_inner_epoch);
+				MUMA_ATOMIC_ADD_FETCH(&muma_inner_epoch_readers[epoch & 1], 1);
+				if (MUMA_ATOMIC_LOAD(&muma_inner_epoch) == epoch) {
+					return epoch;
+				}
+				MUMA_ATOMIC_SUB_FETCH(&muma_inner_epoch_readers[epoch & 1], 1);
+			}
+		}
+
+		MUDEF void muma_epoch_exit(size_m epoch) {
+			MUMA_ATOMIC_SUB_FETCH(&muma_inner_epoch_readers[epoch & 1], 1);
+		}
+
+		MUDEF muBool muma_epoch_reclaim(void) {
+			muma_inner_epoch_lock_acquire();
+
+			// Advancing from E to E+1 needs every reader of E-1 (which
+			// shares its parity with E+1) to be gone; memory retired in
+			// E-1 can't be seen by anyone after that, since readers of E-2
+			// were already gone when E began.
+			size_m epoch = MUMA_ATOMIC_LOAD(&muma_inner_epoch);
+			size_m previous = (epoch+1) & 1;
+			if (MUMA_ATOMIC_LOAD(&muma_inner_epoch_readers[previous]) != 0) {
+				muma_inner_epoch_lock_release();
+				return MU_FALSE;
+			}
+
+			mumaEpochNode* node = muma_inner_epoch_retired[previous];
+			muma_inner_epoch_retired[previous] = MU_NULL_PTR;
+			MUMA_ATOMIC_ADD_FETCH(&muma_inner_epoch, 1);
+			muma_inner_epoch_lock_release();
+
+			while (node != MU_NULL_PTR) {
+				mumaEpochNode* next = node->next;
+				mumaAllocator allocator = node->allocator;
+				muma_allocator_free(&allocator, node, node->size);
+				node = next;
+			}
+			return MU_TRUE;
+		}
+
+		MUDEF void muma_epoch_retire(mumaEpochNode* node, size_m size) {
+			node->size = size;
+			node->allocator = muma_inner_allocator;
+
+			muma_inner_epoch_lock_acquire();
+			size_m epoch = MUMA_ATOMIC_LOAD(&muma_inner_epoch);
+			node->next = muma_inner_epoch_retired[epoch & 1];
+			muma_inner_epoch_retired[epoch & 1] = node;
+			muma_inner_epoch_lock_release();
+
+			muma_epoch_reclaim();
+		}
+
+		MUDEF void muma_epoch_synchronize(void) {
+			// Everything retired so far is freed after at most two
+			// advances of the epoch.
+			for (size_m advances = 0; advances < 2;) {
+				if (muma_epoch_reclaim()) {
+					advances++;
+				} else {
+					muma_inner_yield();
+				}
+			}
+		}
 
 	#ifdef MUMA_NAMES
 		MUDEF const char* muma_result_get_name(mumaResult result) {
@@ -946,6 +8686,10 @@ Note that mu libraries store their dependencies within their files, so you don't
 				case MUMA_INVALID_INDEX: return "MUMA_INVALID_INDEX"; break;
 				case MUMA_INVALID_SHIFT_AMOUNT: return "MUMA_INVALID_SHIFT_AMOUNT"; break;
 				case MUMA_NOT_FOUND: return "MUMA_NOT_FOUND"; break;
+				case MUMA_BUDGET_EXCEEDED: return "MUMA_BUDGET_EXCEEDED"; break;
+				case MUMA_INVALID_HANDLE: return "MUMA_INVALID_HANDLE"; break;
+				case MUMA_IO_FAILED: return "MUMA_IO_FAILED"; break;
+				case MUMA_THREAD_FAILED: return "MUMA_THREAD_FAILED"; break;
 			}
 		}
 	#endif